@@ -19,4 +19,5 @@ from openvino.pyopenvino.offline_transformations import generate_mapping_file
 from openvino.pyopenvino.offline_transformations import apply_make_stateful_transformation
 from openvino.pyopenvino.offline_transformations import compress_model_transformation
 from openvino.pyopenvino.offline_transformations import compress_quantize_weights_transformation
+from openvino.pyopenvino.offline_transformations import compress_weights_groupwise_transformation
 from openvino.pyopenvino.offline_transformations import convert_sequence_to_tensor_iterator_transformation
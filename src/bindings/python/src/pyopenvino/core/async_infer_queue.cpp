@@ -7,7 +7,9 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -19,6 +21,52 @@
 
 namespace py = pybind11;
 
+namespace {
+// Copies the data into the input tensor the request already owns, so that no Tensor is allocated per inference
+void copy_to_input_tensor(ov::InferRequest& request, const py::handle& key, py::array array) {
+    ov::Tensor tensor;
+    if (key.is_none()) {
+        tensor = request.get_input_tensor();
+    } else if (py::isinstance<ov::Output<const ov::Node>>(key)) {
+        tensor = request.get_tensor(key.cast<ov::Output<const ov::Node>>());
+    } else if (py::isinstance<py::str>(key)) {
+        tensor = request.get_tensor(key.cast<std::string>());
+    } else if (py::isinstance<py::int_>(key)) {
+        tensor = request.get_input_tensor(key.cast<size_t>());
+    } else {
+        throw py::type_error("Incompatible key type for tensor named: " + py::str(key).cast<std::string>());
+    }
+    const ov::Shape shape(array.shape(), array.shape() + array.ndim());
+    if (tensor.get_shape() != shape)
+        tensor.set_shape(shape);
+    const auto& dtype = Common::ov_type_to_dtype().at(tensor.get_element_type());
+    if (!array.dtype().equal(dtype))
+        array = array.attr("astype")(dtype);
+    array = Common::as_contiguous(array, tensor.get_element_type());
+    if (static_cast<size_t>(array.nbytes()) != tensor.get_byte_size())
+        throw py::value_error("Input data size doesn't match the size of the input tensor");
+    std::memcpy(tensor.data(), array.data(), tensor.get_byte_size());
+}
+
+void set_batch_item(ov::InferRequest& request, const py::handle& item) {
+    if (py::isinstance<ov::Tensor>(item)) {
+        request.set_input_tensor(item.cast<ov::Tensor>());
+    } else if (py::isinstance<py::dict>(item)) {
+        for (auto&& input : item.cast<py::dict>()) {
+            if (py::isinstance<ov::Tensor>(input.second)) {
+                py::dict tensors;
+                tensors[input.first] = input.second;
+                Common::set_request_tensors(request, tensors);
+            } else {
+                copy_to_input_tensor(request, input.first, input.second.cast<py::array>());
+            }
+        }
+    } else {
+        copy_to_input_tensor(request, py::none(), item.cast<py::array>());
+    }
+}
+}  // namespace
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(std::vector<InferRequestWrapper> requests,
@@ -26,7 +74,8 @@ public:
                     std::vector<py::object> user_ids)
         : _requests(requests),
           _idle_handles(idle_handles),
-          _user_ids(user_ids) {
+          _user_ids(user_ids),
+          _completed(requests.size()) {
         this->set_default_callbacks();
     }
 
@@ -50,9 +99,7 @@ public:
         py::gil_scoped_release release;
         // acquire the mutex to access _errors and _idle_handles
         std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] {
-            return !(_idle_handles.empty());
-        });
+        wait_for_idle_handle(lock);
         size_t idle_handle = _idle_handles.front();
         // wait for request to make sure it returned from callback
         _requests[idle_handle]._request.wait();
@@ -74,6 +121,147 @@ public:
             throw _errors.front();
     }
 
+    void wait_for_idle_handle(std::unique_lock<std::mutex>& lock) {
+        // With the completion queue the finished requests return to the pool only when drained,
+        // so waiting while every request sits in the queue would never end
+        _cv.wait(lock, [this] {
+            return !_idle_handles.empty() || (_use_completion_queue && _completed_count == _requests.size());
+        });
+        if (_idle_handles.empty())
+            throw ov::Exception("All requests of AsyncInferQueue are completed but not drained, "
+                                "call drain_completed() before starting new ones");
+    }
+
+    void start_async_batch(const py::list& inputs, const py::object& userdata) {
+        const size_t count = inputs.size();
+        if (!userdata.is_none() && py::len(userdata) != count)
+            throw py::value_error("Number of userdata items must match number of inputs");
+
+        std::vector<size_t> handles;
+        size_t next = 0;
+        while (next < count) {
+            {
+                // take as many idle requests as available at once
+                py::gil_scoped_release release;
+                std::unique_lock<std::mutex> lock(_mutex);
+                wait_for_idle_handle(lock);
+                if (_errors.size() > 0)
+                    throw _errors.front();
+                while (!_idle_handles.empty() && handles.size() < count - next) {
+                    handles.push_back(_idle_handles.front());
+                    _idle_handles.pop();
+                }
+                lock.unlock();
+                // make sure the requests returned from their callbacks
+                for (auto handle : handles)
+                    _requests[handle]._request.wait();
+            }
+            try {
+                for (auto handle : handles) {
+                    _user_ids[handle] = userdata.is_none() ? py::none() : py::object(userdata[py::int_(next)]);
+                    set_batch_item(_requests[handle]._request, inputs[next]);
+                    ++next;
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (auto handle : handles)
+                    _idle_handles.push(handle);
+                throw;
+            }
+            // GIL is released once per group of requests instead of once per request
+            {
+                py::gil_scoped_release release;
+                for (auto handle : handles) {
+                    _requests[handle]._start_time = Time::now();
+                    _requests[handle]._request.start_async();
+                }
+            }
+            handles.clear();
+        }
+    }
+
+    py::list drain_completed(size_t max_count) {
+        std::vector<CompletedRequest> drained;
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_errors.size() > 0)
+                throw _errors.front();
+            size_t count = _completed_count;
+            if (max_count > 0)
+                count = std::min(count, max_count);
+            drained.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                drained.push_back(std::move(_completed[_completed_head]));
+                _completed_head = (_completed_head + 1) % _completed.size();
+            }
+            _completed_count -= count;
+        }
+
+        std::vector<size_t> handles;
+        handles.reserve(drained.size());
+        for (const auto& completed : drained)
+            handles.push_back(completed.handle);
+        // userdata is copied before the requests become idle, since start_async may overwrite it right after that
+        py::list result;
+        try {
+            for (const auto& completed : drained) {
+                py::object error = completed.error.empty() ? py::object(py::none()) : py::str(completed.error);
+                result.append(py::make_tuple(completed.handle, _user_ids[completed.handle], error));
+            }
+        } catch (...) {
+            release_handles(handles);
+            throw;
+        }
+        release_handles(handles);
+        return result;
+    }
+
+    void release_handles(const std::vector<size_t>& handles) {
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto handle : handles)
+                _idle_handles.push(handle);
+        }
+        _cv.notify_all();
+    }
+
+    void set_completion_queue_callbacks() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _use_completion_queue = true;
+        }
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _requests[handle]._request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                _requests[handle]._end_time = Time::now();
+                // the failed request is queued as well and the error is reported by drain_completed,
+                // otherwise the request would never return to the pool
+                std::string error;
+                if (exception_ptr) {
+                    try {
+                        std::rethrow_exception(exception_ptr);
+                    } catch (const std::exception& e) {
+                        error = e.what();
+                    } catch (...) {
+                        error = "Unknown exception";
+                    }
+                }
+                {
+                    // acquire the mutex to access the completion queue, no GIL is needed here
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    // a request can't be restarted before it is drained, so the queue never overflows
+                    auto& completed = _completed[(_completed_head + _completed_count) % _completed.size()];
+                    completed.handle = handle;
+                    completed.error = std::move(error);
+                    _completed_count++;
+                }
+                // Notify locks in getIdleRequestId()
+                _cv.notify_one();
+            });
+        }
+    }
+
     void set_default_callbacks() {
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
@@ -98,6 +286,7 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        disable_completion_queue();
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
@@ -134,12 +323,31 @@ public:
         }
     }
 
+    void disable_completion_queue() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // requests left in the completion queue become idle
+        for (; _completed_count > 0; _completed_count--) {
+            _idle_handles.push(_completed[_completed_head].handle);
+            _completed_head = (_completed_head + 1) % _completed.size();
+        }
+        _use_completion_queue = false;
+    }
+
     std::vector<InferRequestWrapper> _requests;
     std::queue<size_t> _idle_handles;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
     std::mutex _mutex;
     std::condition_variable _cv;
     std::queue<py::error_already_set> _errors;
+    struct CompletedRequest {
+        size_t handle = 0;
+        std::string error;  // empty if the inference succeeded
+    };
+    // ring buffer of finished requests waiting for drain_completed()
+    std::vector<CompletedRequest> _completed;
+    size_t _completed_head = 0;
+    size_t _completed_count = 0;
+    bool _use_completion_queue = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -265,6 +473,54 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    cls.def("start_async_batch",
+            &AsyncInferQueue::start_async_batch,
+            py::arg("inputs"),
+            py::arg("userdata") = py::none(),
+            R"(
+            Run asynchronous inference for a list of inputs using the available InferRequests.
+
+            Each item of the list is either the data for a single-input model or a dict of
+            the data of the inputs. openvino.runtime.Tensor is set to the request, while
+            other data (numpy arrays, scalars) is copied into the input tensors the request
+            already owns, so no Tensor is allocated per inference. The requests are taken
+            from the pool as soon as they become idle and are started in groups, releasing
+            the GIL once per group instead of once per request.
+
+            :param inputs: Data to set on input tensors of the requests, one item per request.
+            :type inputs: List[Union[openvino.runtime.Tensor, numpy.ndarray, dict[Union[int, str, openvino.runtime.ConstOutput] : Union[openvino.runtime.Tensor, numpy.ndarray]]]]
+            :param userdata: Userdata for every item of inputs. Default: None
+            :type userdata: List[Any], optional
+            :rtype: None
+
+            GIL is released while waiting for idle InferRequests and while starting them.
+        )");
+
+    cls.def("use_completion_queue",
+            &AsyncInferQueue::set_completion_queue_callbacks,
+            R"(
+            Replaces callbacks of all InferRequests from the pool with a completion queue.
+
+            Finished requests are put into the queue without acquiring the GIL and stay there,
+            with their results untouched, until they are returned by drain_completed.
+            Only then they become idle again. Calling set_callback turns the queue off.
+        )");
+
+    cls.def("drain_completed",
+            &AsyncInferQueue::drain_completed,
+            py::arg("max_count") = 0,
+            R"(
+            Returns finished InferRequests from the completion queue and returns them to the pool.
+
+            Results of a drained request stay valid until the request is started again.
+
+            :param max_count: Maximum number of requests to drain, 0 drains all of them. Default: 0
+            :type max_count: int
+            :return: List of (id, userdata, error) of finished InferRequests in completion order,
+                     error is None if the inference succeeded or the error message otherwise.
+            :rtype: List[Tuple[int, Any, Optional[str]]]
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
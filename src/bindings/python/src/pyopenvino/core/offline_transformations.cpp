@@ -118,6 +118,16 @@ void regmodule_offline_transformations(py::module m) {
         },
         py::arg("model"));
 
+    m_offline_transformations.def(
+        "compress_weights_groupwise_transformation",
+        [](std::shared_ptr<ov::Model> model, size_t group_size) {
+            ov::pass::Manager manager;
+            manager.register_pass<ngraph::pass::CompressWeightsGroupwise>(group_size);
+            manager.run_passes(model);
+        },
+        py::arg("model"),
+        py::arg("group_size") = 128);
+
     m_offline_transformations.def(
         "convert_sequence_to_tensor_iterator_transformation",
         [](std::shared_ptr<ov::Model> model) {
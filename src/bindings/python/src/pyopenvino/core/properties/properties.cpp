@@ -29,6 +29,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
     wrap_property_RW(m_properties, ov::affinity, "affinity");
     wrap_property_RW(m_properties, ov::force_tbb_terminate, "force_tbb_terminate");
+    wrap_property_RW(m_properties, ov::enable_mmap, "enable_mmap");
 
     wrap_property_RO(m_properties, ov::supported_properties, "supported_properties");
     wrap_property_RO(m_properties, ov::available_devices, "available_devices");
@@ -71,6 +72,9 @@ void regmodule_properties(py::module m) {
 
     // Submodule intel_cpu property
     wrap_property_RW(m_intel_cpu, ov::intel_cpu::denormals_optimization, "denormals_optimization");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::core_budget, "core_budget");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::reserved_cores, "reserved_cores");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::sparse_weights_decompression_rate, "sparse_weights_decompression_rate");
 
     // Submodule device
     py::module m_device =
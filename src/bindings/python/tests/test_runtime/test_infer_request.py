@@ -537,6 +537,86 @@ def test_infer_queue_fail_on_py_model(device):
     assert "unsupported operand type(s) for +" in str(e.value)
 
 
+def test_infer_queue_start_async_batch(device):
+    jobs = 8
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 3)
+    infer_queue.use_completion_queue()
+
+    data = [np.full(10, -i if i % 2 else i, dtype=np.float32) for i in range(jobs)]
+    infer_queue.start_async_batch(data[:2], [0, 1])
+    infer_queue.wait_all()
+    completed = infer_queue.drain_completed()
+    assert sorted(userdata for _, userdata, _ in completed) == [0, 1]
+    assert all(error is None for _, _, error in completed)
+
+    results = {}
+    infer_queue.start_async_batch(data[2:5], list(range(2, 5)))
+    infer_queue.wait_all()
+    for request_id, userdata, _ in infer_queue.drain_completed():
+        results[userdata] = infer_queue[request_id].get_output_tensor().data.copy()
+    # the completed requests stay out of the pool until drained
+    infer_queue.start_async_batch(data[5:], list(range(5, jobs)))
+    infer_queue.wait_all()
+    for request_id, userdata, _ in infer_queue.drain_completed(max_count=jobs):
+        results[userdata] = infer_queue[request_id].get_output_tensor().data.copy()
+
+    assert sorted(results.keys()) == list(range(2, jobs))
+    for job, result in results.items():
+        assert np.array_equal(result, np.maximum(data[job], 0))
+
+
+def test_infer_queue_start_async_batch_copies_to_request_tensors(device):
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+    infer_queue.use_completion_queue()
+    input_pointers = [request.get_input_tensor().data.ctypes.data for request in infer_queue]
+
+    data = [np.full(10, -1.5, dtype=np.float32), {0: np.arange(10, dtype=np.float64)}]
+    infer_queue.start_async_batch(data, ["array", "dict"])
+    infer_queue.wait_all()
+    for request_id, userdata, error in infer_queue.drain_completed():
+        assert error is None
+        request = infer_queue[request_id]
+        # the data is copied into the tensors the requests own, no new ones are set
+        assert request.get_input_tensor().data.ctypes.data == input_pointers[request_id]
+        expected = np.zeros(10) if userdata == "array" else np.arange(10)
+        assert np.array_equal(request.get_output_tensor().data, expected)
+
+
+def test_infer_queue_start_async_batch_throughput(device):
+    jobs = 2000
+    core = Core()
+    param = ops.parameter([1, 64], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    data = [np.full((1, 64), i, dtype=np.float32) for i in range(jobs)]
+
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    start = time.perf_counter()
+    for i in range(jobs):
+        infer_queue.start_async(data[i], i)
+    infer_queue.wait_all()
+    per_request_time = time.perf_counter() - start
+
+    batch_queue = AsyncInferQueue(compiled_model, 4)
+    start = time.perf_counter()
+    batch_queue.start_async_batch(data, list(range(jobs)))
+    batch_queue.wait_all()
+    batch_time = time.perf_counter() - start
+
+    print(f"start_async: {jobs / per_request_time:.0f} infer/s, "
+          f"start_async_batch: {jobs / batch_time:.0f} infer/s")
+    # the timings are noisy on shared machines, so only a severe slowdown fails
+    assert batch_time < 2 * per_request_time
+
+
 def test_infer_queue_get_idle_handle(device):
     param = ops.parameter([10])
     model = Model(ops.relu(param), [param])
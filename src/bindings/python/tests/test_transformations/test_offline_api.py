@@ -12,6 +12,7 @@ from openvino.offline_transformations import (
     apply_pruning_transformation,
     apply_make_stateful_transformation,
     compress_model_transformation,
+    compress_weights_groupwise_transformation,
     convert_sequence_to_tensor_iterator_transformation,
 )
 
@@ -174,6 +175,31 @@ def test_compress_model_transformation():
     assert elem_type == "f16"
 
 
+def test_compress_weights_groupwise_transformation():
+    core = Core()
+    xml_path = "./serialized_model.xml"
+    bin_path = "./serialized_model.bin"
+    parameter = ov.opset8.parameter([1, 256], dtype=np.float32, name="X")
+    weights = ov.opset8.constant(np.random.uniform(-1, 1, [64, 256]).astype(np.float32))
+    model = Model(ov.opset8.matmul(parameter, weights, False, True), [parameter], "TestModel")
+    compress_weights_groupwise_transformation(model, group_size=128)
+
+    def get_constant_types(model):
+        return [op.get_element_type().get_type_name() for op in model.get_ordered_ops() if op.get_type_name() == "Constant"]
+
+    assert "u4" in get_constant_types(model)
+    assert "f32" in get_constant_types(model)
+
+    serialize(model, xml_path, bin_path)
+    res_model = core.read_model(model=xml_path, weights=bin_path)
+    assert "u4" in get_constant_types(res_model)
+    # 4-bit weights are stored packed
+    assert os.path.getsize(bin_path) < 64 * 256
+
+    os.remove(xml_path)
+    os.remove(bin_path)
+
+
 def test_version_default():
     core = Core()
     xml_path = "./serialized_model.xml"
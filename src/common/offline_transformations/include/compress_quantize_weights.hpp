@@ -11,6 +11,7 @@ namespace pass {
 
 class CompressQuantizeWeights;
 class ZeroPointOptimizer;
+class CompressWeightsGroupwise;
 
 }  // namespace pass
 }  // namespace ngraph
@@ -91,3 +92,64 @@ public:
     OPENVINO_RTTI("ZeroPointOptimizer");
     ZeroPointOptimizer();
 };
+
+/*
+    CompressWeightsGroupwise transformation quantizes floating point MatMul weights to 4-bit type
+    with separate scale (and zero point for u4) for every group of group_size weights along the input channels.
+
+    Initial graph (Constant weights [O, I] with transpose_b = true):
+
+                                +-----------------+
+                                |    Constant     |
+                                |     [O, I]      |
+                                +-----------------+
+                                        |
+                                        v
+                                +-----------------+
+                                |     MatMul      |
+                                +-----------------+
+
+    is replaced to:
+                                +-----------------+
+                                |    Constant     |
+                                |   (u4 or i4)    |
+                                |  [O, G, group]  |
+                                +-----------------+
+                                        |
+                                        v
+                                +------------------+
+                                |     Convert      |
+                                |  (to high prec)  |
+                                +------------------+
+                                        |
+                                        v
+    +----------------------+      +------------+
+    | zero point (u4 only) |----->|  Subtract  |
+    |  [O, G, 1] + Convert |      +-----+------+
+    +----------------------+            |
+                                        v
+                 +-----------+    +------------+
+                 |   scale   |--->|  Multiply  |
+                 | [O, G, 1] |    +-----+------+
+                 +-----------+          |
+                                        v
+                                +-----------------+
+                                |     Reshape     |
+                                |     [O, I]      |
+                                +-----------------+
+                                        |
+                                        v
+                                +-----------------+
+                                |     MatMul      |
+                                +-----------------+
+
+    where G = I / group. Not transposed weights [I, O] are split to [G, group, O] with [G, 1, O] scales.
+    The 4-bit constants are stored packed in the IR. The decompression Converts are excluded from constant folding,
+    so the weights stay packed until a plugin consumes the decompression subgraph.
+    The weights with the number of input channels not divisible by the group size are skipped.
+*/
+class ngraph::pass::CompressWeightsGroupwise: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("CompressWeightsGroupwise", "0");
+    explicit CompressWeightsGroupwise(size_t group_size = 128, const element::Type& weights_type = element::u4);
+};
@@ -7,6 +7,7 @@
 #include <ngraph/validation_util.hpp>
 #include <ngraph/rt_info.hpp>
 #include <openvino/pass/constant_folding.hpp>
+#include <transformations/rt_info/decompression.hpp>
 #include <compress_quantize_weights.hpp>
 
 static bool has_dequantization_subgraph(const std::shared_ptr<ngraph::Node>& first_convert) {
@@ -32,6 +33,13 @@ static bool has_dequantization_subgraph(const std::shared_ptr<ngraph::Node>& fir
     return multiply != convert_or_subtract_users.end();
 }
 
+// The decompression mark is kept by Serialize and the IR frontend, so the Convert is not folded after read_model
+// as well (see DisableDecompressionConvertConstantFolding). The in-memory flag covers ConstantFolding run without it.
+static void mark_as_decompression_convert(const std::shared_ptr<ngraph::Node>& convert) {
+    ov::mark_as_decompression(convert);
+    ov::pass::disable_constant_folding(convert);
+}
+
 ngraph::pass::CompressQuantizeWeights::CompressQuantizeWeights() {
     auto weights_pattern = pattern::wrap_type<opset8::Constant>();
     auto input_low_pattern = pattern::wrap_type<opset8::Constant>();
@@ -68,7 +76,7 @@ ngraph::pass::CompressQuantizeWeights::CompressQuantizeWeights() {
                 // preserve dequantization subgraph for LP transformations
                 auto weights_users = new_weights->get_users();
                 if (weights_users.size() == 1 && ov::is_type<ngraph::opset8::Convert>(weights_users[0])) {
-                    ov::pass::disable_constant_folding(weights_users[0]);
+                    mark_as_decompression_convert(weights_users[0]);
                 }
                 return true;
             } else {
@@ -149,7 +157,7 @@ ngraph::pass::CompressQuantizeWeights::CompressQuantizeWeights() {
             auto mul = register_new_node<opset8::Multiply>(sub, scale);
             mul->set_friendly_name(fq->get_friendly_name());
             copy_runtime_info(fq, {convert_to_high_prec, sub, mul});
-            ov::pass::disable_constant_folding(convert_to_high_prec);
+            mark_as_decompression_convert(convert_to_high_prec);
             replace_node(fq, mul);
         }
         return true;
@@ -229,3 +237,106 @@ ngraph::pass::ZeroPointOptimizer::ZeroPointOptimizer() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(sub_pattern, "ZeroPointOptimizer");
     this->register_matcher(m, callback);
 }
+
+ngraph::pass::CompressWeightsGroupwise::CompressWeightsGroupwise(size_t group_size, const element::Type& weights_type) {
+    NGRAPH_CHECK(group_size > 0, "CompressWeightsGroupwise: group size must be positive");
+    NGRAPH_CHECK(weights_type == element::u4 || weights_type == element::i4,
+                 "CompressWeightsGroupwise: only u4 and i4 weights are supported, got ", weights_type);
+    auto weights_pattern = pattern::wrap_type<opset8::Constant>(pattern::type_matches_any({element::f32, element::f16}));
+    auto matmul_pattern = pattern::wrap_type<opset8::MatMul>({pattern::any_input(), weights_pattern});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        const auto& pattern_value_map = m.get_pattern_value_map();
+        auto matmul = std::dynamic_pointer_cast<opset8::MatMul>(pattern_value_map.at(matmul_pattern).get_node_shared_ptr());
+        auto weights = std::dynamic_pointer_cast<opset8::Constant>(pattern_value_map.at(weights_pattern).get_node_shared_ptr());
+        if (!matmul || !weights)
+            return false;
+        const auto& shape = weights->get_shape();
+        if (shape.size() != 2)
+            return false;
+
+        // input channels are the first dimension of the not transposed weights
+        const bool transposed = matmul->get_transpose_b();
+        const size_t num_inputs = transposed ? shape[1] : shape[0];
+        const size_t num_outputs = transposed ? shape[0] : shape[1];
+        if (num_inputs % group_size != 0)
+            return false;
+        const size_t num_groups = num_inputs / group_size;
+
+        const Shape grouped_shape = transposed ? Shape{num_outputs, num_groups, group_size}
+                                               : Shape{num_groups, group_size, num_outputs};
+        const Shape group_params_shape = transposed ? Shape{num_outputs, num_groups, 1}
+                                                    : Shape{num_groups, 1, num_outputs};
+        // for every weight returns its index in the grouped parameters
+        auto group_params_index = [&](size_t index) {
+            const size_t row = index / shape[1];
+            const size_t column = index % shape[1];
+            return transposed ? row * num_groups + column / group_size
+                              : (row / group_size) * num_outputs + column;
+        };
+
+        const auto values = weights->cast_vector<float>();
+        const size_t num_params = shape_size(group_params_shape);
+        std::vector<float> min_values(num_params, 0.f);
+        std::vector<float> max_values(num_params, 0.f);
+        for (size_t i = 0; i < values.size(); i++) {
+            const size_t param_index = group_params_index(i);
+            min_values[param_index] = std::min(min_values[param_index], values[i]);
+            max_values[param_index] = std::max(max_values[param_index], values[i]);
+        }
+
+        /*
+            u4: asymmetric quantization, the range of every group is extended to contain zero
+                scale = (max - min) / 15, zero_point = round(-min / scale), q = clamp(round(w / scale) + zero_point, 0, 15)
+            i4: symmetric quantization
+                scale = max(|min|, |max|) / 7, q = clamp(round(w / scale), -8, 7)
+        */
+        const bool is_signed = weights_type == element::i4;
+        const float q_min = is_signed ? -8.f : 0.f;
+        const float q_max = is_signed ? 7.f : 15.f;
+        std::vector<float> scales(num_params);
+        std::vector<uint8_t> zero_points(num_params, 0);
+        for (size_t i = 0; i < num_params; i++) {
+            const float range = is_signed ? std::max(-min_values[i], max_values[i]) / q_max
+                                          : (max_values[i] - min_values[i]) / q_max;
+            scales[i] = range > 0.f ? range : 1.f;
+            if (!is_signed)
+                zero_points[i] = static_cast<uint8_t>(std::min(q_max, std::max(0.f, std::nearbyint(-min_values[i] / scales[i]))));
+        }
+
+        std::vector<int8_t> quantized(values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            const size_t param_index = group_params_index(i);
+            const float q = std::nearbyint(values[i] / scales[param_index]) + zero_points[param_index];
+            quantized[i] = static_cast<int8_t>(std::min(q_max, std::max(q_min, q)));
+        }
+
+        const auto& high_type = weights->get_element_type();
+        auto new_weights = opset8::Constant::create(weights_type, grouped_shape, quantized);
+        new_weights->set_friendly_name(weights->get_friendly_name());
+        auto convert_to_high_prec = std::make_shared<opset8::Convert>(new_weights, high_type);
+        mark_as_decompression_convert(convert_to_high_prec);
+        NodeVector new_ops{new_weights, convert_to_high_prec};
+
+        std::shared_ptr<Node> dequantized = convert_to_high_prec;
+        if (!is_signed) {
+            auto zero_point = opset8::Constant::create(element::u4, group_params_shape, zero_points);
+            auto zero_point_convert = std::make_shared<opset8::Convert>(zero_point, high_type);
+            mark_as_decompression_convert(zero_point_convert);
+            dequantized = std::make_shared<opset8::Subtract>(dequantized, zero_point_convert);
+            new_ops.insert(new_ops.end(), {zero_point, zero_point_convert, dequantized});
+        }
+        auto scale = opset8::Constant::create(high_type, group_params_shape, scales);
+        dequantized = std::make_shared<opset8::Multiply>(dequantized, scale);
+        auto target_shape = opset8::Constant::create(element::i64, Shape{shape.size()}, shape);
+        auto reshape = std::make_shared<opset8::Reshape>(dequantized, target_shape, false);
+        new_ops.insert(new_ops.end(), {scale, dequantized, target_shape, reshape});
+
+        copy_runtime_info(weights, new_ops);
+        matmul->input(1).replace_source_output(reshape);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_pattern, "CompressWeightsGroupwise");
+    this->register_matcher(m, callback);
+}
@@ -45,6 +45,9 @@ void splitRowImpl(isa_tag_t, const T* in, std::array<T*, chs>& outs, const int l
 template<typename isa_tag_t, typename T, int chs>
 void mergeRowImpl(isa_tag_t, const std::array<const T*, chs>& ins, T* out, const int length);
 
+template<typename isa_tag_t, typename src_t, typename dst_t>
+void convertPrecisionRowImpl(isa_tag_t, const src_t* in, dst_t* out, const int length);
+
 template<typename isa_tag_t>
 bool calcRowLinear8UC1Impl(isa_tag_t, uint8_t* dst[], const uint8_t* src0[], const uint8_t* src1[],
                            const short alpha[], const short clone[], const short mapsx[],
@@ -510,6 +510,11 @@ template void mergeRowImpl<avx2_tag, float, 3>(avx2_tag, const std::array<const
 template void mergeRowImpl<avx2_tag, uint8_t, 4>(avx2_tag, const std::array<const uint8_t*, 4>& ins, uint8_t* out, const int length);
 template void mergeRowImpl<avx2_tag, float, 4>(avx2_tag, const std::array<const float*, 4>& ins, float* out, const int length);
 
+template void convertPrecisionRowImpl(avx2_tag, const uint8_t*  in, float*    out, const int length);
+template void convertPrecisionRowImpl(avx2_tag, const uint16_t* in, float*    out, const int length);
+template void convertPrecisionRowImpl(avx2_tag, const float*    in, uint8_t*  out, const int length);
+template void convertPrecisionRowImpl(avx2_tag, const float*    in, uint16_t* out, const int length);
+
 template void calcRowLinear32FC1Impl(avx2_tag, float* dst[], const float* src0[], const float* src1[],
                                      const float alpha[], const int mapsx[],
                                      const float beta[], const Size& inSz, const Size& outSz,
@@ -536,6 +536,11 @@ template void mergeRowImpl<avx512_tag, float, 3>(avx512_tag, const std::array<co
 template void mergeRowImpl<avx512_tag, uint8_t, 4>(avx512_tag, const std::array<const uint8_t*, 4>& ins, uint8_t* out, const int length);
 template void mergeRowImpl<avx512_tag, float, 4>(avx512_tag, const std::array<const float*, 4>& ins, float* out, const int length);
 
+template void convertPrecisionRowImpl(avx512_tag, const uint8_t*  in, float*    out, const int length);
+template void convertPrecisionRowImpl(avx512_tag, const uint16_t* in, float*    out, const int length);
+template void convertPrecisionRowImpl(avx512_tag, const float*    in, uint8_t*  out, const int length);
+template void convertPrecisionRowImpl(avx512_tag, const float*    in, uint16_t* out, const int length);
+
 template void calcRowLinear32FC1Impl(avx512_tag, float* dst[], const float* src0[],
                                      const float* src1[], const float alpha[],
                                      const int mapsx[], const float beta[],
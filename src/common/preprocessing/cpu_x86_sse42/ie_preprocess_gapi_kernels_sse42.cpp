@@ -1278,6 +1278,11 @@ template void mergeRowImpl<sse42_tag, float, 3>(sse42_tag, const std::array<cons
 template void mergeRowImpl<sse42_tag, uchar, 4>(sse42_tag, const std::array<const uint8_t*, 4>& ins, uint8_t* out, const int length);
 template void mergeRowImpl<sse42_tag, float, 4>(sse42_tag, const std::array<const float*, 4>& ins, float* out, const int length);
 
+template void convertPrecisionRowImpl(sse42_tag, const uint8_t*  in, float*    out, const int length);
+template void convertPrecisionRowImpl(sse42_tag, const uint16_t* in, float*    out, const int length);
+template void convertPrecisionRowImpl(sse42_tag, const float*    in, uint8_t*  out, const int length);
+template void convertPrecisionRowImpl(sse42_tag, const float*    in, uint16_t* out, const int length);
+
 template void calcRowLinear32FC1Impl(sse42_tag, float* dst[], const float* src0[], const float* src1[],
                                      const float alpha[], const int mapsx[],
                                      const float beta[], const Size& inSz, const Size& outSz,
@@ -574,8 +574,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
+    const bool four_channels = !specific_yuv420_input_handling && in_desc.d.C == 4 && out_desc.d.C == 4;
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
-                                        && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
+                                        && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel
+                                            || four_channels)
                                         && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
@@ -596,7 +598,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             color_converted_input = inputs;
         }
 
-        auto planes = drop_channel ?
+        auto planes = (drop_channel || four_channels) ?
                 to_vec(gapi::ScalePlanes4:: on(
                         color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR))
               : to_vec(gapi::ScalePlanes  ::on(
@@ -613,7 +615,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
-            outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
+            outputs = merge(planes, static_cast<int>(planes.size()));
         } else {
             outputs = planes;
         }
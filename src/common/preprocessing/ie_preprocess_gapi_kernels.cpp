@@ -31,6 +31,7 @@
 #include <opencv2/gapi/gcompoundkernel.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -1271,6 +1272,105 @@ inline p_f operator()(type_to_type<type>) {
 };
 }  // namespace
 
+namespace {
+
+inline float f16ToF32(fp_16_t h) {
+    const uint16_t v = static_cast<uint16_t>(h.v);
+    const uint32_t sign = static_cast<uint32_t>(v & 0x8000) << 16;
+    uint32_t exponent = (v >> 10) & 0x1f;
+    uint32_t mantissa = v & 0x3ff;
+
+    uint32_t bits = sign;
+    if (exponent == 0x1f) {
+        bits |= 0x7f800000 | (mantissa << 13);  // inf or nan
+    } else if (exponent != 0) {
+        bits |= ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa != 0) {
+        // subnormal: normalize the mantissa
+        exponent = 113;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits |= (exponent << 23) | ((mantissa & 0x3ff) << 13);
+    }
+
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline fp_16_t f32ToF16(float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t abs = bits & 0x7fffffff;
+    uint32_t h = 0;
+    if (abs >= 0x7f800000) {
+        h = abs > 0x7f800000 ? 0x7e00 : 0x7c00;  // nan or inf
+    } else if (abs >= 0x477ff000) {
+        h = 0x7c00;  // rounds to a value out of the f16 range
+    } else if (abs >= 0x38800000) {
+        // normal: rebias the exponent and round the mantissa to nearest even
+        const uint32_t rebiased = abs - 0x38000000;
+        h = (rebiased + 0xfff + ((rebiased >> 13) & 1)) >> 13;
+    } else if (abs > 0x33000000) {
+        // subnormal
+        const uint32_t shift = 126 - (abs >> 23);
+        const uint32_t mantissa = (abs & 0x7fffff) | 0x800000;
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+        const uint32_t half = 1u << (shift - 1);
+        h = mantissa >> shift;
+        if (rest > half || (rest == half && (h & 1)))
+            h++;
+    }
+
+    return fp_16_t{static_cast<int16_t>(sign | h)};
+}
+
+template <typename src_t, typename dst_t>
+inline void convertPrecisionRowImpl(scalar_tag, const src_t* in, dst_t* out, const int length) {
+    for (int x = 0; x < length; x++) {
+        out[x] = saturate_cast<dst_t>(in[x]);
+    }
+}
+
+template <typename dst_t>
+inline void convertPrecisionRowImpl(scalar_tag, const fp_16_t* in, dst_t* out, const int length) {
+    for (int x = 0; x < length; x++) {
+        out[x] = saturate_cast<dst_t>(f16ToF32(in[x]));
+    }
+}
+
+template <typename src_t>
+inline void convertPrecisionRowImpl(scalar_tag, const src_t* in, fp_16_t* out, const int length) {
+    for (int x = 0; x < length; x++) {
+        out[x] = f32ToF16(saturate_cast<float>(in[x]));
+    }
+}
+
+inline void convertPrecisionRowImpl(scalar_tag, const fp_16_t* in, fp_16_t* out, const int length) {
+    std::copy(in, in + length, out);
+}
+
+// Only the conversions to and from f32 have SIMD versions, the others always take the scalar path
+template <typename src_t, typename dst_t>
+using has_simd_conversion = std::integral_constant<bool,
+    (std::is_same<src_t, float>::value && (std::is_same<dst_t, uint8_t>::value || std::is_same<dst_t, uint16_t>::value)) ||
+    (std::is_same<dst_t, float>::value && (std::is_same<src_t, uint8_t>::value || std::is_same<src_t, uint16_t>::value))>;
+
+template <typename isa_tag_t, typename src_t, typename dst_t>
+void convert_precision(const uint8_t* src, uint8_t* dst, const int width) {
+    using impl_tag_t = typename std::conditional<has_simd_conversion<src_t, dst_t>::value, isa_tag_t, scalar_tag>::type;
+
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<dst_t *>(dst);
+
+    convertPrecisionRowImpl(impl_tag_t{}, in, out, width);
+}
+}  // namespace
+
 template <typename isa_tag_t>
 struct choose_impl {
 GAPI_FLUID_KERNEL(FChanToPlane, ChanToPlane, false) {
@@ -1469,6 +1569,53 @@ GAPI_FLUID_KERNEL(FMerge4, Merge4, false) {
     }
 };
 
+GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, int depth, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F ||
+                    src.meta().depth == CV_16U || src.meta().depth == CV_16F);
+        GAPI_Assert(dst.meta().depth == CV_8U || dst.meta().depth == CV_32F ||
+                    dst.meta().depth == CV_16U || dst.meta().depth == CV_16F);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        constexpr unsigned supported_types_n = 4;
+        using p_f = void (*)( const uint8_t* src,  uint8_t* dst, const int width);
+        using table_string_t = std::array<p_f, supported_types_n>;
+
+        constexpr std::array<table_string_t, supported_types_n> func_table = {
+                table_string_t{convert_precision<isa_tag_t, uint16_t, uint16_t>, convert_precision<isa_tag_t, uint16_t, float>,
+                               convert_precision<isa_tag_t, uint16_t, uint8_t>,  convert_precision<isa_tag_t, uint16_t, fp_16_t>},
+                table_string_t{convert_precision<isa_tag_t, float,    uint16_t>, convert_precision<isa_tag_t, float,    float>,
+                               convert_precision<isa_tag_t, float,    uint8_t>,  convert_precision<isa_tag_t, float,    fp_16_t>},
+                table_string_t{convert_precision<isa_tag_t, uint8_t,  uint16_t>, convert_precision<isa_tag_t, uint8_t,  float>,
+                               convert_precision<isa_tag_t, uint8_t,  uint8_t>,  convert_precision<isa_tag_t, uint8_t,  fp_16_t>},
+                table_string_t{convert_precision<isa_tag_t, fp_16_t,  uint16_t>, convert_precision<isa_tag_t, fp_16_t,  float>,
+                               convert_precision<isa_tag_t, fp_16_t,  uint8_t>,  convert_precision<isa_tag_t, fp_16_t,  fp_16_t>}
+        };
+
+        auto depth_to_index = [](int depth){
+            switch (depth) {
+                case  CV_16U: return 0;
+                case  CV_32F: return 1;
+                case  CV_8U:  return 2;
+                case  CV_16F: return 3;
+                default: GAPI_Assert(!"not supported depth"); return -1;
+            }
+        };
+        const auto *in  = src.InLineB(0);
+              auto *out = dst.OutLineB();
+
+        auto const width = dst.length();
+        auto const src_index = depth_to_index(src.meta().depth);
+        auto const dst_index = depth_to_index(dst.meta().depth);
+
+        (func_table[src_index][dst_index])(in, out, width);
+    }
+};
+
 template<typename KT, typename TL>
 static inline void callRowFunc(uint8_t* dst[], const uint8_t* src0[],
                                const uint8_t* src1[], const short alpha[],
@@ -1870,6 +2017,7 @@ struct CC_and_MergeISA {
         pckg.include<typename choose_impl<isa_tag_t>::FMerge2>();
         pckg.include<typename choose_impl<isa_tag_t>::FMerge3>();
         pckg.include<typename choose_impl<isa_tag_t>::FMerge4>();
+        pckg.include<typename choose_impl<isa_tag_t>::FConvertDepth>();
         //at the moment type_dispatch requires something to be returned by the lambda
         return true;
     }
@@ -1953,59 +2101,6 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
 
 //------------------------------------------------------------------------------
 
-namespace {
-
-template <typename src_t, typename dst_t>
-void convert_precision(const uint8_t* src, uint8_t* dst, const int width) {
-    const auto *in  = reinterpret_cast<const src_t *>(src);
-          auto *out = reinterpret_cast<dst_t *>(dst);
-
-    for (int i = 0; i < width; i++) {
-        out[i] = saturate_cast<dst_t>(in[i]);
-    }
-}
-
-}  // namespace
-
-GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
-    static const int Window = 1;
-
-    static void run(const cv::gapi::fluid::View& src, int depth, cv::gapi::fluid::Buffer& dst) {
-        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F || src.meta().depth == CV_16U);
-        GAPI_Assert(dst.meta().depth == CV_8U || dst.meta().depth == CV_32F || dst.meta().depth == CV_16U);
-        GAPI_Assert(src.meta().chan == 1);
-        GAPI_Assert(dst.meta().chan == 1);
-        GAPI_Assert(src.length() == dst.length());
-
-        constexpr unsigned supported_types_n = 3;
-        using p_f = void (*)( const uint8_t* src,  uint8_t* dst, const int width);
-        using table_string_t = std::array<p_f, supported_types_n>;
-
-        constexpr std::array<table_string_t, supported_types_n> func_table = {
-                table_string_t{convert_precision<uint16_t, uint16_t>, convert_precision<uint16_t, float>, convert_precision<uint16_t, uint8_t>},
-                table_string_t{convert_precision<float,    uint16_t>, convert_precision<float,    float>, convert_precision<float,    uint8_t>},
-                table_string_t{convert_precision<uint8_t,  uint16_t>, convert_precision<uint8_t,  float>, convert_precision<uint8_t,  uint8_t>}
-        };
-
-        auto depth_to_index = [](int depth){
-            switch (depth) {
-                case  CV_16U: return 0;
-                case  CV_32F: return 1;
-                case  CV_8U:  return 2;
-                default: GAPI_Assert(!"not supported depth"); return -1;
-            }
-        };
-        const auto *in  = src.InLineB(0);
-              auto *out = dst.OutLineB();
-
-        auto const width = dst.length();
-        auto const src_index = depth_to_index(src.meta().depth);
-        auto const dst_index = depth_to_index(dst.meta().depth);
-
-        (func_table[src_index][dst_index])(in, out, width);
-    }
-};
-
 namespace {
     template <typename src_t, typename dst_t>
     void sub(const uint8_t* src, uint8_t* dst, const int width, double c) {
@@ -2069,7 +2164,6 @@ cv::gapi::GKernelPackage preprocKernels() {
         FKernelsChooseISA(),
         cv::gapi::kernels
         < FScalePlane
-        , FConvertDepth
         , FSubC
         , FDivC
         >());
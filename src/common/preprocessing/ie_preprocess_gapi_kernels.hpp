@@ -191,8 +191,8 @@ namespace gapi {
 
     G_TYPED_KERNEL(ConvertDepth, <cv::GMat(cv::GMat, int depth)>, "com.intel.ie.ConvertDepth") {
         static cv::GMatDesc outMeta(const cv::GMatDesc& in, int depth) {
-            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
-            GAPI_Assert(depth == CV_8U || depth == CV_32F || depth == CV_16U);
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F || in.depth == CV_16F);
+            GAPI_Assert(depth == CV_8U || depth == CV_32F || depth == CV_16U || depth == CV_16F);
 
             return in.withDepth(depth);
         }
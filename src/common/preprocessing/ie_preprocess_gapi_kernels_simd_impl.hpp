@@ -705,6 +705,83 @@ CV_ALWAYS_INLINE void calcRowLinear32FC1Impl(isa_tag_t,
     }
 }
 
+// Element type conversion (ConvertDepth): only the conversions to and from f32 are vectorized,
+// rounding and saturation follow the scalar saturate_cast<>
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertRow_Impl(isa_tag_t, const uint8_t* in, float* out, const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+    for (; x <= length - nlanes; x += nlanes) {
+        v_int32 r = v_reinterpret_as_s32(vx_load_expand_q(&in[x]));
+        vx_store(&out[x], v_cvt_f32(r));
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = static_cast<float>(in[x]);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertRow_Impl(isa_tag_t, const uint16_t* in, float* out, const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+    for (; x <= length - nlanes; x += nlanes) {
+        v_int32 r = v_reinterpret_as_s32(vx_load_expand(&in[x]));
+        vx_store(&out[x], v_cvt_f32(r));
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = static_cast<float>(in[x]);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertRow_Impl(isa_tag_t, const float* in, uint8_t* out, const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_uint8::nlanes;
+    constexpr int qlanes = v_float32::nlanes;
+    for (; x <= length - nlanes; x += nlanes) {
+        v_int16 lo = v_pack(v_round(vx_load(&in[x])),             v_round(vx_load(&in[x + qlanes])));
+        v_int16 hi = v_pack(v_round(vx_load(&in[x + 2 * qlanes])), v_round(vx_load(&in[x + 3 * qlanes])));
+        vx_store(&out[x], v_pack_u(lo, hi));
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = saturate_cast<uint8_t>(in[x]);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertRow_Impl(isa_tag_t, const float* in, uint16_t* out, const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_uint16::nlanes;
+    constexpr int hlanes = v_float32::nlanes;
+    for (; x <= length - nlanes; x += nlanes) {
+        vx_store(&out[x], v_pack_u(v_round(vx_load(&in[x])), v_round(vx_load(&in[x + hlanes]))));
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = saturate_cast<uint16_t>(in[x]);
+    }
+}
+
+template<typename isa_tag_t, typename src_t, typename dst_t>
+CV_ALWAYS_INLINE void convertPrecisionRowImpl(isa_tag_t, const src_t* in, dst_t* out, const int length) {
+    convertRow_Impl(isa_tag_t{}, in, out, length);
+}
+
 template<typename isa_tag_t, typename scalar_t>
 struct vector_type_of;
 
@@ -21,9 +21,12 @@ class BroadcastLoad : public BroadcastMove {
 public:
     OPENVINO_OP("BroadcastLoad", "SnippetsOpset", ngraph::snippets::op::BroadcastMove);
 
-    BroadcastLoad(const Output<Node>& x, Shape output_shape);
+    BroadcastLoad(const Output<Node>& x, Shape output_shape, const element::Type& dst_type = element::undefined);
     BroadcastLoad() = default;
 
+    // Element type the op produces; undefined means the input type is kept
+    const element::Type& get_destination_type() const { return m_dst_type; }
+
     bool visit_attributes(AttributeVisitor& visitor) override;
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
@@ -40,6 +43,7 @@ public:
 
 private:
     Shape broadcast_info;
+    element::Type m_dst_type;
 };
 
 } // namespace op
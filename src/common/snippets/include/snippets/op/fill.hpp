@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Fill
+ * @brief Generated by Generator and loads a spilled value from a stack slot of the kernel to a vector register
+ *        right before it's used
+ * @ingroup snippets
+ */
+class Fill : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Fill", "SnippetsOpset");
+
+    Fill(size_t slot);
+    Fill() = default;
+
+    size_t get_slot() const { return m_slot; }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<Fill>(m_slot);
+    }
+
+private:
+    size_t m_slot = 0;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
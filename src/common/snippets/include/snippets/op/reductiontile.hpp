@@ -0,0 +1,36 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "snippets/emitter.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ReductionTile
+ * @brief Generated by Generator and represents a complete pass over the innermost dimension which computes
+ *        a horizontal reduction. Data pointers are restored after the pass, so the same data could be read again
+ *        by the following passes
+ * @ingroup snippets
+ */
+class ReductionTile : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ReductionTile", "SnippetsOpset");
+
+    ReductionTile(const std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>& region);
+    ReductionTile() = default;
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> region;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<ReductionTile>(region);
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
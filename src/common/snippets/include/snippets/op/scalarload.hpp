@@ -20,12 +20,12 @@ class ScalarLoad : public Load {
 public:
     OPENVINO_OP("ScalarLoad", "SnippetsOpset", ngraph::snippets::op::Load);
 
-    ScalarLoad(const Output<Node>& x);
+    ScalarLoad(const Output<Node>& x, const element::Type& dst_type = element::undefined);
     ScalarLoad() = default;
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
         check_new_args_count(this, new_args);
-        return std::make_shared<ScalarLoad>(new_args.at(0));
+        return std::make_shared<ScalarLoad>(new_args.at(0), m_dst_type);
     }
 };
 
@@ -20,12 +20,12 @@ class ScalarStore : public Store {
 public:
     OPENVINO_OP("ScalarStore", "SnippetsOpset", ngraph::snippets::op::Store);
 
-    ScalarStore(const Output<Node>& x);
+    ScalarStore(const Output<Node>& x, const element::Type& dst_type = element::undefined);
     ScalarStore() = default;
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
         check_new_args_count(this, new_args);
-        return std::make_shared<ScalarStore>(new_args.at(0));
+        return std::make_shared<ScalarStore>(new_args.at(0), m_dst_type);
     }
 };
 
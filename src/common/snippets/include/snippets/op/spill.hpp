@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Spill
+ * @brief Generated by Generator and stores a vector register to a stack slot of the kernel, when the value
+ *        doesn't fit into the register file
+ * @ingroup snippets
+ */
+class Spill : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Spill", "SnippetsOpset");
+
+    Spill(size_t slot);
+    Spill() = default;
+
+    size_t get_slot() const { return m_slot; }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<Spill>(m_slot);
+    }
+
+private:
+    size_t m_slot = 0;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
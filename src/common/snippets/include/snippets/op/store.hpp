@@ -19,9 +19,12 @@ class Store : public ngraph::op::Op {
 public:
     OPENVINO_OP("Store", "SnippetsOpset");
 
-    Store(const Output<Node>& x);
+    Store(const Output<Node>& x, const element::Type& dst_type = element::undefined);
     Store() = default;
 
+    // Element type the op produces; undefined means the input type is kept
+    const element::Type& get_destination_type() const { return m_dst_type; }
+
     bool visit_attributes(AttributeVisitor& visitor) override;
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
@@ -31,6 +34,9 @@ public:
     OPENVINO_SUPPRESS_DEPRECATED_START
     bool evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const override;
     OPENVINO_SUPPRESS_DEPRECATED_END
+
+protected:
+    element::Type m_dst_type;
 };
 
 } // namespace op
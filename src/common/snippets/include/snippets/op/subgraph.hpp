@@ -97,6 +97,10 @@ public:
     snippets::Schedule generate(const void* compile_params = nullptr);
     Shape canonicalize(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes);
 
+    // Returns true if the body reduces the innermost dimension (e.g. Softmax or MVN).
+    // Such a body is generated as several passes over the innermost dimension, so it must not be collapsed or blocked.
+    bool has_reductions() const;
+
     // plugin sets generator for a snippet to some specific generator.
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ngraph::snippets::Generator> generator);
@@ -20,12 +20,12 @@ class VectorLoad : public Load {
 public:
     OPENVINO_OP("VectorLoad", "SnippetsOpset", ngraph::snippets::op::Load);
 
-    VectorLoad(const Output<Node>& x);
+    VectorLoad(const Output<Node>& x, const element::Type& dst_type = element::undefined);
     VectorLoad() = default;
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
         check_new_args_count(this, new_args);
-        return std::make_shared<VectorLoad>(new_args.at(0));
+        return std::make_shared<VectorLoad>(new_args.at(0), m_dst_type);
     }
 };
 
@@ -14,14 +14,25 @@ namespace pass {
  * @interface AssignRegisters
  * @brief Assigns internal `vector` register indexes to operations.
  * Changing order of variables or datafrow lead to invalidation of register assignment.
+ * If live values don't fit into the register file, some of them are spilled to the stack (or rematerialized
+ * if they are Scalars). Spilled values are defined and used through scratch registers:
+ *   - "spillSlot" is set for the producer, it's stored to the slot right after it's computed;
+ *   - "rematerialize" is set for the Scalar producer, it's computed again right before every use instead;
+ *   - "reginfoIn" is set for the consumer, it lists registers the inputs are filled to before it's computed.
  * @ingroup snippets
  */
 class AssignRegisters : public ngraph::pass::FunctionPass {
 public:
-    AssignRegisters() {
+    /**
+     * @param reg_count number of vector registers available for allocation
+     */
+    AssignRegisters(size_t reg_count = 16) : m_reg_count(reg_count) {
         set_property(ngraph::pass::PassProperty::REQUIRE_STATIC_SHAPE, true);
     }
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+private:
+    size_t m_reg_count;
 };
 
 }  // namespace pass
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface FuseLoadConvert
+ * @brief Fuses Load and consecutive Convert into a single Load with the destination element type.
+ * The pass is used to convert model to a canonical form for code generation
+ * @ingroup snippets
+ */
+class FuseLoadConvert: public ngraph::pass::MatcherPass {
+public:
+    FuseLoadConvert();
+};
+
+/**
+ * @interface FuseStoreConvert
+ * @brief Fuses f32 -> bf16 Convert and consecutive Store into a single Store with the destination element type.
+ * The pass is used to convert model to a canonical form for code generation
+ * @ingroup snippets
+ */
+class FuseStoreConvert: public ngraph::pass::MatcherPass {
+public:
+    FuseStoreConvert();
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
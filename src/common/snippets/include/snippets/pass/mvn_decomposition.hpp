@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface MVNDecomposition
+ * @brief Decomposes MVN over the innermost dimension to HorizonSum based mean and variance computation.
+ * The innermost dimension must be static since the mean is computed as a sum multiplied by a scalar 1/N
+ * @ingroup snippets
+ */
+class MVNDecomposition: public ngraph::pass::MatcherPass {
+public:
+    MVNDecomposition();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface SoftmaxDecomposition
+ * @brief Decomposes Softmax over the innermost dimension to HorizonMax, Subtract, Exp, HorizonSum and Divide,
+ * so it could be generated as a sequence of passes over the innermost dimension inside one kernel
+ * @ingroup snippets
+ */
+class SoftmaxDecomposition: public ngraph::pass::MatcherPass {
+public:
+    SoftmaxDecomposition();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
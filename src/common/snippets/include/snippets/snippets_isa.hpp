@@ -11,13 +11,18 @@
 #include "op/blockedparameter.hpp"
 #include "op/broadcastload.hpp"
 #include "op/broadcastmove.hpp"
+#include "op/fill.hpp"
+#include "op/horizonmax.hpp"
+#include "op/horizonsum.hpp"
 #include "op/kernel.hpp"
 #include "op/load.hpp"
 #include "op/nop.hpp"
 #include "op/scalar.hpp"
 #include "op/scalarload.hpp"
 #include "op/scalarstore.hpp"
+#include "op/spill.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reductiontile.hpp"
 #include "op/store.hpp"
 #include "op/tile.hpp"
 #include "op/vectorload.hpp"
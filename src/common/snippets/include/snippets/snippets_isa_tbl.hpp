@@ -21,6 +21,8 @@ NGRAPH_OP(ScalarStore, ngraph::snippets::op)
 NGRAPH_OP(VectorStore, ngraph::snippets::op)
 
 NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
+NGRAPH_OP(HorizonMax, ngraph::snippets::op)
+NGRAPH_OP(HorizonSum, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
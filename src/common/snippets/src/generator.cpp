@@ -8,10 +8,51 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/reductiontile.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
 
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+using EmitterCode = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+
+auto is_horizon(const std::shared_ptr<ngraph::Node>& n) -> bool {
+    return ov::is_type<ngraph::snippets::op::HorizonMax>(n) || ov::is_type<ngraph::snippets::op::HorizonSum>(n);
+}
+
+// Selects emitters of the operations needed to compute the sinks. Horizontal reductions are computed
+// by their own passes before, so neither them nor their producers are visited.
+auto select_pass(const std::vector<EmitterCode>& lowered, const ngraph::NodeVector& ordered_ops, const ngraph::NodeVector& sinks) -> EmitterCode {
+    std::unordered_set<ngraph::Node*> visited;
+    std::vector<ngraph::Node*> stack;
+    for (const auto& sink : sinks) {
+        if (!is_horizon(sink))
+            stack.push_back(sink.get());
+    }
+    while (!stack.empty()) {
+        auto node = stack.back();
+        stack.pop_back();
+        if (!visited.insert(node).second)
+            continue;
+        for (const auto& input : node->input_values()) {
+            if (!is_horizon(input.get_node_shared_ptr()))
+                stack.push_back(input.get_node());
+        }
+    }
+
+    EmitterCode selected;
+    for (size_t i = 0; i < ordered_ops.size(); i++) {
+        if (visited.count(ordered_ops[i].get()))
+            selected.insert(selected.end(), lowered[i].begin(), lowered[i].end());
+    }
+    return selected;
+}
+} // namespace
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
     auto rt = n->get_rt_info();
@@ -25,7 +66,16 @@ auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph:
         }
     }
 
+    // inputs of the operation are filled to scratch registers, if some of them are spilled
     std::vector<size_t> rin;
+    it_rt = rt.find("reginfoIn");
+    if (it_rt != rt.end()) {
+        for (auto reg : it_rt->second.as<std::vector<size_t>>()) {
+            rin.push_back(reg);
+        }
+        return std::make_pair(rin, rout);
+    }
+
     for (auto input : n->inputs()) {
         auto rt = input.get_source_output().get_node_shared_ptr()->get_rt_info();
         auto it_rt = rt.find("reginfo");
@@ -52,8 +102,9 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
 
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
+    const auto ops = m->get_ordered_ops();
     std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
-    for (auto n : m->get_ordered_ops()) {
+    for (auto n : ops) {
         lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
@@ -65,27 +116,122 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     mng.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
+    const auto scalar_ops = m_scalar->get_ordered_ops();
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
-    for (auto n : m_scalar->get_ordered_ops()) {
+    for (auto n : scalar_ops) {
         scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
+    NGRAPH_CHECK(ops.size() == scalar_ops.size(), "vector and scalar tiles are expected to have the same number of operations");
+    OV_ITT_TASK_NEXT(GENERATE, "::Spills")
+    // Spilled values are stored to the stack right after they are computed and loaded back before every use,
+    // rematerialized Scalars are computed before every use instead. See AssignRegisters for details.
+    std::map<int64_t, std::pair<std::shared_ptr<Emitter>, std::shared_ptr<Emitter>>> spill_emitters;
+    auto get_spill_emitters = [&](int64_t slot) {
+        if (!spill_emitters.count(slot)) {
+            std::shared_ptr<ngraph::Node> spill = std::make_shared<ngraph::snippets::op::Spill>(slot);
+            std::shared_ptr<ngraph::Node> fill = std::make_shared<ngraph::snippets::op::Fill>(slot);
+            spill_emitters[slot] = std::make_pair(target->get(spill->get_type_info())(spill), target->get(fill->get_type_info())(fill));
+        }
+        return spill_emitters[slot];
+    };
+    auto expand_spills = [&](const NodeVector& ordered_ops, const EmitterCode& code) {
+        std::unordered_map<ngraph::Node*, size_t> index;
+        for (size_t i = 0; i < ordered_ops.size(); i++)
+            index[ordered_ops[i].get()] = i;
+        std::vector<EmitterCode> expanded(ordered_ops.size());
+        for (size_t i = 0; i < ordered_ops.size(); i++) {
+            const auto& rt = ordered_ops[i]->get_rt_info();
+            if (rt.count("rematerialize"))
+                continue;
+            const auto& in_regs = code[i].second.first;
+            size_t k = 0;
+            for (const auto& input : ordered_ops[i]->input_values()) {
+                const auto& producer_rt = input.get_node()->get_rt_info();
+                if (!producer_rt.count("reginfo"))
+                    continue;
+                const RegInfo fill_regs = std::make_pair(std::vector<size_t>{}, std::vector<size_t>{in_regs[k++]});
+                if (producer_rt.count("rematerialize"))
+                    expanded[i].push_back(std::make_pair(code[index[input.get_node()]].first, fill_regs));
+                else if (producer_rt.count("spillSlot"))
+                    expanded[i].push_back(std::make_pair(get_spill_emitters(producer_rt.at("spillSlot").as<int64_t>()).second, fill_regs));
+            }
+            expanded[i].push_back(code[i]);
+            if (rt.count("spillSlot")) {
+                const RegInfo spill_regs = std::make_pair(code[i].second.second, std::vector<size_t>{});
+                expanded[i].push_back(std::make_pair(get_spill_emitters(rt.at("spillSlot").as<int64_t>()).first, spill_regs));
+            }
+        }
+        return expanded;
+    };
+    const auto vector_code = expand_spills(ops, lowered);
+    const auto scalar_code = expand_spills(scalar_ops, scalar_lowered);
+
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
+    auto make_tile = [&](const std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>>& region, size_t inc, size_t previous_inc) {
+        auto tile = std::make_shared<ngraph::snippets::op::Tile>(region);
+        tile->compile_params = compile_params;
+        return std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                              std::make_pair(std::vector<size_t>({inc, previous_inc, nptrs, 1}), std::vector<size_t>{}));
+    };
 
     // wrapping into tiles1D
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D;
-    auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                                   std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
-    tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                    std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    // Every horizontal reduction is computed in a separate pass over the innermost dimension before the main tiles:
+    //   acc = identity; vector tile { producers; acc = op(acc, x) }; reduce acc lanes;
+    //   scalar tile { producers; acc = op(acc, x) }; broadcast the first lane of acc
+    // The result stays in acc register, so the following passes and the main tiles could use it.
+    std::vector<std::shared_ptr<Emitter>> reduction_emitters;
+    for (size_t i = 0; i < ops.size(); i++) {
+        auto horizon = ops[i];
+        if (!is_horizon(horizon))
+            continue;
+        const auto regs = ngraph::snippets::getRegisters(horizon);
+        const auto acc = regs.second[0];
+        const auto src = regs.first[0];
+        const auto type = ops[i]->get_input_element_type(0);
+        const bool is_max = ov::is_type<ngraph::snippets::op::HorizonMax>(ops[i]);
+
+        // auxiliary operations are created only to instantiate emitters for the pass
+        const auto param = std::make_shared<ngraph::opset1::Parameter>(type, Shape{1});
+        std::shared_ptr<ngraph::Node> init = std::make_shared<ngraph::snippets::op::Scalar>(type, Shape{1},
+                                                           is_max ? -std::numeric_limits<float>::infinity() : 0.f);
+        std::shared_ptr<ngraph::Node> accumulate = is_max ? std::shared_ptr<ngraph::Node>(std::make_shared<ngraph::opset1::Maximum>(param, param))
+                                                          : std::shared_ptr<ngraph::Node>(std::make_shared<ngraph::opset1::Add>(param, param));
+        std::shared_ptr<ngraph::Node> broadcast = std::make_shared<ngraph::snippets::op::BroadcastMove>(param, Shape{target->get_lanes()});
+        const auto init_emitter = target->get(init->get_type_info())(init);
+        const auto accumulate_emitter = target->get(accumulate->get_type_info())(accumulate);
+        const auto broadcast_emitter = target->get(broadcast->get_type_info())(broadcast);
+        reduction_emitters.insert(reduction_emitters.end(), {init_emitter, accumulate_emitter, broadcast_emitter});
+        const RegInfo accumulate_regs = std::make_pair(std::vector<size_t>{acc, src}, std::vector<size_t>{acc});
+        const RegInfo acc_regs = std::make_pair(std::vector<size_t>{acc}, std::vector<size_t>{acc});
+
+        auto vector_pass = select_pass(vector_code, ops, {ops[i]->get_input_node_shared_ptr(0)});
+        vector_pass.push_back(std::make_pair(accumulate_emitter, accumulate_regs));
+        auto scalar_pass = select_pass(scalar_code, scalar_ops, {scalar_ops[i]->get_input_node_shared_ptr(0)});
+        scalar_pass.push_back(std::make_pair(accumulate_emitter, accumulate_regs));
+
+        std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> reduction_pass;
+        reduction_pass.push_back(std::make_pair(init_emitter, std::make_pair(std::vector<size_t>{}, std::vector<size_t>{acc})));
+        reduction_pass.push_back(make_tile(vector_pass, target->get_lanes(), 0));
+        reduction_pass.push_back(std::make_pair(lowered[i].first, acc_regs));
+        reduction_pass.push_back(make_tile(scalar_pass, 1, target->get_lanes()));
+        reduction_pass.push_back(std::make_pair(broadcast_emitter, acc_regs));
+
+        auto reduction_tile = std::make_shared<ngraph::snippets::op::ReductionTile>(reduction_pass);
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::ReductionTile::get_type_info_static())(reduction_tile),
+                                         std::make_pair(std::vector<size_t>{nptrs}, std::vector<size_t>{})));
+    }
+
+    // main tiles compute only what is needed for the outputs, reduction results are already in registers
+    const auto scalar_results = m_scalar->get_results();
+    tiles1D.push_back(make_tile(select_pass(vector_code, ops, NodeVector(results.begin(), results.end())), target->get_lanes(), 0));
+    tiles1D.push_back(make_tile(select_pass(scalar_code, scalar_ops, NodeVector(scalar_results.begin(), scalar_results.end())),
+                                1, target->get_lanes()));
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles2D;
-    tile = std::make_shared<ngraph::snippets::op::Tile>(tiles1D);
+    auto tile = std::make_shared<ngraph::snippets::op::Tile>(tiles1D);
     tile->compile_params = compile_params;
     tiles2D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
                                      std::make_pair(std::vector<size_t>({1, 0, nptrs, 0}), std::vector<size_t>{})));
@@ -95,12 +241,19 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto tiles2DKernel = std::make_shared<ngraph::snippets::op::Kernel>(tiles2D);
     tiles2DKernel->compile_params = compile_params;
     std::shared_ptr<Emitter> kernel = target->get(ngraph::snippets::op::Kernel::get_type_info_static())(tiles2DKernel);
-    kernel->emit_code({in, out}, {});
+    kernel->emit_code({in, out, spill_emitters.size()}, {});
     OV_ITT_TASK_NEXT(GENERATE, "::EmitData")
     lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
     for (auto& op : lowered) {
         op.first->emit_data();
     }
+    for (auto& emitter : reduction_emitters) {
+        emitter->emit_data();
+    }
+    for (auto& emitters : spill_emitters) {
+        emitters.second.first->emit_data();
+        emitters.second.second->emit_data();
+    }
     OV_ITT_TASK_NEXT(GENERATE, "::GetSnippet")
     return target->get_snippet();
 }
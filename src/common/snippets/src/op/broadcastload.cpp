@@ -11,8 +11,8 @@
 using namespace std;
 using namespace ngraph;
 
-snippets::op::BroadcastLoad::BroadcastLoad(const Output<Node>& x, Shape shape)
-: BroadcastMove(x, shape), broadcast_info(x.get_shape().size(), 0) {
+snippets::op::BroadcastLoad::BroadcastLoad(const Output<Node>& x, Shape shape, const element::Type& dst_type)
+: BroadcastMove(x, shape), broadcast_info(x.get_shape().size(), 0), m_dst_type(dst_type) {
     constructor_validate_and_infer_types();
 }
 
@@ -23,11 +23,11 @@ bool snippets::op::BroadcastLoad::visit_attributes(AttributeVisitor& visitor) {
 std::shared_ptr<Node> snippets::op::BroadcastLoad::clone_with_new_inputs(const OutputVector& new_args) const {
     INTERNAL_OP_SCOPE(BroadcastLoad);
     check_new_args_count(this, new_args);
-    auto other = std::make_shared<BroadcastLoad>(new_args.at(0), output_shape);
+    auto other = std::make_shared<BroadcastLoad>(new_args.at(0), output_shape, m_dst_type);
     other->set_broadcast_info(this->broadcast_info);
     return other;
 }
 
 void snippets::op::BroadcastLoad::validate_and_infer_types() {
-    set_output_type(0, get_input_element_type(0), output_shape);
+    set_output_type(0, m_dst_type == element::undefined ? get_input_element_type(0) : m_dst_type, output_shape);
 }
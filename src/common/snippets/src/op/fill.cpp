@@ -0,0 +1,11 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/fill.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Fill::Fill(size_t slot) : Op(), m_slot(slot) {
+}
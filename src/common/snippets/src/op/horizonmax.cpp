@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/horizonmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::HorizonMax::HorizonMax(const Output<Node>& x) : Op({x}) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::HorizonMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(HorizonMax);
+    check_new_args_count(this, new_args);
+    return std::make_shared<HorizonMax>(new_args.at(0));
+}
+
+void snippets::op::HorizonMax::validate_and_infer_types() {
+    auto output_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, output_shape.rank().is_static() && output_shape.rank().get_length() > 0,
+                          "HorizonMax expects input of static non-zero rank");
+    *output_shape.rbegin() = 1;
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
@@ -11,7 +11,7 @@
 using namespace std;
 using namespace ngraph;
 
-snippets::op::Load::Load(const Output<Node>& x) : Op({x}) {
+snippets::op::Load::Load(const Output<Node>& x, const element::Type& dst_type) : Op({x}), m_dst_type(dst_type) {
     constructor_validate_and_infer_types();
 }
 
@@ -22,11 +22,11 @@ bool snippets::op::Load::visit_attributes(AttributeVisitor& visitor) {
 std::shared_ptr<Node> snippets::op::Load::clone_with_new_inputs(const OutputVector& new_args) const {
     INTERNAL_OP_SCOPE(Load);
     check_new_args_count(this, new_args);
-    return std::make_shared<Load>(new_args.at(0));
+    return std::make_shared<Load>(new_args.at(0), m_dst_type);
 }
 
 void snippets::op::Load::validate_and_infer_types() {
-    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    set_output_type(0, m_dst_type == element::undefined ? get_input_element_type(0) : m_dst_type, get_input_partial_shape(0));
 }
 
 bool snippets::op::Load::evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const {
@@ -37,6 +37,7 @@ bool snippets::op::Load::evaluate(const HostTensorVector& output_values, const H
     NGRAPH_CHECK(this->output(0).get_shape() == output_values[0]->get_shape(), "output vector must have the same shape as output port");
     NGRAPH_CHECK(this->input(0).get_shape() == input_values[0]->get_shape(), "input and output must have same shape");
     NGRAPH_CHECK(this->input(0).get_shape() == input_values[0]->get_shape(), "input and output must have same shape");
+    NGRAPH_CHECK(input_values[0]->get_element_type() == output_values[0]->get_element_type(), "precision conversion is not supported");
 
     std::copy(input_values[0]->get_data_ptr<uint8_t>(),
         input_values[0]->get_data_ptr<uint8_t>() + shape_size(get_output_shape(0))*output_values[0]->get_element_type().size(),
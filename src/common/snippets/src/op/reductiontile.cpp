@@ -0,0 +1,13 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/reductiontile.hpp"
+#include "snippets/generator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::ReductionTile::ReductionTile(const std::vector<std::pair<std::shared_ptr<snippets::Emitter>, snippets::RegInfo>>& nested)
+    : Op(), region(nested) {
+}
@@ -6,5 +6,5 @@
 
 using namespace ngraph;
 
-snippets::op::ScalarLoad::ScalarLoad(const Output<Node>& x) : Load(x) {
+snippets::op::ScalarLoad::ScalarLoad(const Output<Node>& x, const element::Type& dst_type) : Load(x, dst_type) {
 }
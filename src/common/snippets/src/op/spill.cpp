@@ -0,0 +1,11 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/spill.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Spill::Spill(size_t slot) : Op(), m_slot(slot) {
+}
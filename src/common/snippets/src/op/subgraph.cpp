@@ -7,14 +7,19 @@
 
 #include "snippets/op/subgraph.hpp"
 #include "snippets/pass/insert_load_store.hpp"
+#include "snippets/pass/fuse_load_store_convert.hpp"
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/load_movebroadcast_to_broadcastload.hpp"
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
+#include "snippets/pass/softmax_decomposition.hpp"
+#include "snippets/pass/mvn_decomposition.hpp"
 
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <openvino/pass/serialize.hpp>
 
 #include <algorithm>
@@ -175,8 +180,11 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = m_body->get_parameters()[i]->get_shape();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()))
+        // Body could be canonicalized several times (e.g. each time input shapes are changed), and the parameters
+        // could have dynamic shapes if it's the first canonicalization
+        const auto& param = m_body->get_parameters()[i];
+        const auto& paramShape = param->get_partial_shape();
+        if (paramShape.is_dynamic() || paramShape.get_shape() != inShape || param->get_element_type() != inType)
                 m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(inType, inShape));
     }
 
@@ -217,6 +225,14 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
     return exec_domain;
 }
 
+bool snippets::op::Subgraph::has_reductions() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& op) {
+        return ov::is_type<opset1::Softmax>(op) || ov::is_type<opset8::Softmax>(op) || ov::is_type<opset6::MVN>(op) ||
+               ov::is_type<snippets::op::HorizonMax>(op) || ov::is_type<snippets::op::HorizonSum>(op);
+    });
+}
+
 void snippets::op::Subgraph::convert_to_snippet_dialect() {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::convert_to_snippet_dialect")
@@ -224,10 +240,14 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         return n->get_input_shape(0).back() != 1;
     };
     ngraph::pass::Manager manager;
+    manager.register_pass<snippets::pass::SoftmaxDecomposition>();
+    manager.register_pass<snippets::pass::MVNDecomposition>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
     manager.register_pass<snippets::pass::InsertStore>();
+    manager.register_pass<snippets::pass::FuseLoadConvert>();
+    manager.register_pass<snippets::pass::FuseStoreConvert>();
     manager.register_pass<snippets::pass::InsertMoveBroadcast>();
     manager.register_pass<snippets::pass::LoadMoveBroadcastToBroadcastLoad>();
     // Note that, BrodacastMove is typically inserted right after the Load. Such cases are typical for
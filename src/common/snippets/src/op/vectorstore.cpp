@@ -6,5 +6,5 @@
 
 using namespace ngraph;
 
-snippets::op::VectorStore::VectorStore(const Output<Node>& x) : Store(x) {
+snippets::op::VectorStore::VectorStore(const Output<Node>& x, const element::Type& dst_type) : Store(x, dst_type) {
 }
@@ -104,34 +104,96 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         return i;
     };
 
+    auto is_horizon = [](const std::shared_ptr<Node>& n) {
+        return ov::is_type<snippets::op::HorizonMax>(n) || ov::is_type<snippets::op::HorizonSum>(n);
+    };
+
+    // Generator emits the producers of a horizontal reduction once again in each of the following passes over
+    // the innermost dimension, so reduction results must survive the whole kernel. They get dedicated registers
+    // taken from the end of the bank, the rest of the bank is used by the linear scan.
+    std::map<Reg, Reg> register_map;
+    size_t reserved = 0;
     for (size_t i = 0; i < stmts.size(); i++) {
-        live_intervals.insert(std::make_pair(i, find_last_use(i)));
+        if (is_horizon(stmts[i])) {
+            register_map[i] = m_reg_count - 1 - reserved++;
+        } else {
+            live_intervals.insert(std::make_pair(i, find_last_use(i)));
+        }
     }
+    if (reserved >= m_reg_count)
+        throw ngraph_error("cannot allocate registers for a snippet: too many horizontal reductions");
+
+    // Scalar is cheaper to compute again right before the use than to store and load it. The only exception is
+    // the input of a horizontal reduction: it's consumed by the reduction pass right after it's computed.
+    auto is_rematerializable = [&](int i) {
+        if (!ov::is_type<snippets::op::Scalar>(stmts[i]))
+            return false;
+        const auto consumers = stmts[i]->get_output_target_inputs(0);
+        return std::none_of(consumers.begin(), consumers.end(), [&](const Input<Node>& in) {
+            return is_horizon(in.get_node()->shared_from_this());
+        });
+    };
+    // Values without uses and rematerializable Scalars cost nothing to be kept out of registers,
+    // the others need a store after the definition and a load before every use
+    auto spill_cost = [&](const std::pair<int, int>& interval) -> int {
+        return interval.first == interval.second || is_rematerializable(interval.first) ? 0 : 1;
+    };
 
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
-    std::multiset<std::pair<int, int>, by_ending> active;
-    std::map<Reg, Reg> register_map;
-    std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
-
-    for (auto interval : live_intervals) {
-        // check expired
-        while (!active.empty()) {
-            auto x = *active.begin();
-            if (x.second >= interval.first) {
-                break;
+    // If all the registers are busy, the cheapest interval with the furthest end is spilled:
+    // its value is kept in memory and goes through scratch registers at the definition and uses.
+    std::set<int> spilled;
+    auto linear_scan = [&](size_t available, bool can_spill) -> bool {
+        std::multiset<std::pair<int, int>, by_ending> active;
+        std::stack<Reg> bank;
+        for (size_t i = 0; i < available; i++) bank.push(available-1-i);
+
+        for (auto interval : live_intervals) {
+            // check expired
+            while (!active.empty()) {
+                auto x = *active.begin();
+                if (x.second >= interval.first) {
+                    break;
+                }
+                active.erase(x);
+                bank.push(register_map[x.first]);
             }
-            active.erase(x);
-            bank.push(register_map[x.first]);
-        }
-        // allocate
-        if (active.size() == 16) {
-            throw ngraph_error("caanot allocate registers for a snippet ");
-        } else {
-            register_map[interval.first] = bank.top();
-            bank.pop();
-            active.insert(interval);
+            // allocate
+            if (active.size() < available) {
+                register_map[interval.first] = bank.top();
+                bank.pop();
+                active.insert(interval);
+                continue;
+            }
+            if (!can_spill)
+                return false;
+            auto victim = interval;
+            for (const auto& x : active) {
+                if (spill_cost(x) < spill_cost(victim) || (spill_cost(x) == spill_cost(victim) && x.second > victim.second))
+                    victim = x;
+            }
+            if (victim != interval) {
+                register_map[interval.first] = register_map[victim.first];
+                active.erase(victim);
+                active.insert(interval);
+            }
+            spilled.insert(victim.first);
         }
+        return true;
+    };
+
+    size_t scratch_start = 0;
+    if (!linear_scan(m_reg_count - reserved, false)) {
+        // an operation may need all its inputs filled and the output defined at the same time
+        size_t max_inputs = 0;
+        for (const auto& op : stmts)
+            max_inputs = std::max(max_inputs, op->get_input_size());
+        if (reserved + max_inputs + 1 >= m_reg_count)
+            throw ngraph_error("cannot allocate registers for a snippet: not enough registers for spilling");
+        scratch_start = m_reg_count - reserved - max_inputs - 1;
+        linear_scan(scratch_start, true);
+        for (auto i : spilled)
+            register_map[i] = scratch_start + max_inputs;
     }
 
     std::map<std::shared_ptr<descriptor::Tensor>, Reg> physical_regs;
@@ -140,6 +202,57 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         physical_regs[reg.first] = register_map[reg.second];
     }
 
+    if (!spilled.empty()) {
+        // stack slots are allocated by the same linear scan, but there is no limit for them
+        std::map<int, int64_t> slots;
+        std::multiset<std::pair<int, int>, by_ending> in_memory;
+        std::stack<int64_t> free_slots;
+        int64_t slot_count = 0;
+        for (auto interval : live_intervals) {
+            if (!spilled.count(interval.first) || spill_cost(interval) == 0)
+                continue;
+            while (!in_memory.empty() && in_memory.begin()->second < interval.first) {
+                free_slots.push(slots[in_memory.begin()->first]);
+                in_memory.erase(in_memory.begin());
+            }
+            if (free_slots.empty()) {
+                slots[interval.first] = slot_count++;
+            } else {
+                slots[interval.first] = free_slots.top();
+                free_slots.pop();
+            }
+            in_memory.insert(interval);
+        }
+
+        for (size_t i = 0; i < stmts.size(); i++) {
+            auto& rt = stmts[i]->get_rt_info();
+            if (spilled.count(i)) {
+                if (is_rematerializable(i))
+                    rt["rematerialize"] = true;
+                else if (slots.count(i))
+                    rt["spillSlot"] = slots[i];
+            }
+            // input of a horizontal reduction is taken directly from the scratch register it's defined to
+            if (is_horizon(stmts[i]))
+                continue;
+            std::vector<size_t> in_regs;
+            bool has_spilled_inputs = false;
+            for (size_t k = 0; k < stmts[i]->get_input_size(); k++) {
+                const auto tensor = stmts[i]->input(k).get_tensor_ptr();
+                if (!regs.count(tensor))
+                    continue;
+                if (spilled.count(regs[tensor])) {
+                    in_regs.push_back(scratch_start + k);
+                    has_spilled_inputs = true;
+                } else {
+                    in_regs.push_back(physical_regs[tensor]);
+                }
+            }
+            if (has_spilled_inputs)
+                rt["reginfoIn"] = in_regs;
+        }
+    }
+
     size_t constantID = 0;
 
     for (auto n : f->get_ordered_ops()) {
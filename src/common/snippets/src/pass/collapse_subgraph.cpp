@@ -10,6 +10,8 @@
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/op/loop.hpp>
 #include "transformations/utils/utils.hpp"
@@ -32,6 +34,16 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // Dimensions are known only in runtime, so we can only check that the output shapes could be broadcasted to each other
+    // (the ranks are guaranteed to be static by has_supported_in_out)
+    if (std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& out) { return out.get_partial_shape().is_dynamic(); })) {
+        const auto ref_rank = outputs.begin()->get_partial_shape().rank();
+        PartialShape merged_shape = outputs.begin()->get_partial_shape();
+        return std::any_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {
+            return out.get_partial_shape().rank() != ref_rank ||
+                   !PartialShape::broadcast_merge_into(merged_shape, out.get_partial_shape(), ::ngraph::op::AutoBroadcastType::NUMPY);
+        });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -104,10 +116,66 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
     return is_layout_oblivious_unary(n) || is_layout_oblivious_binary(n);
 }
 
+// Reductions are supported only over the innermost dimension: the kernel reads it in several passes,
+// so the whole dimension must be processed by one kernel call
+auto is_supported_reduction(const std::shared_ptr<const Node> &n) -> bool {
+    const auto& data_shape = n->get_input_partial_shape(0);
+    if (data_shape.rank().is_dynamic() || data_shape.rank().get_length() == 0)
+        return false;
+    const int64_t innermost_axis = data_shape.rank().get_length() - 1;
+    if (const auto softmax = ov::as_type_ptr<const opset1::Softmax>(n))
+        return static_cast<int64_t>(softmax->get_axis()) == innermost_axis;
+    if (const auto softmax = ov::as_type_ptr<const opset8::Softmax>(n)) {
+        const auto axis = softmax->get_axis();
+        return (axis < 0 ? axis + innermost_axis + 1 : axis) == innermost_axis;
+    }
+    if (const auto mvn = ov::as_type_ptr<const opset6::MVN>(n)) {
+        const auto axes = ov::as_type_ptr<const opset1::Constant>(mvn->get_input_node_shared_ptr(1));
+        // the mean is computed as a sum multiplied by 1/N, so N must be known in compile time
+        if (!axes || data_shape[innermost_axis].is_dynamic())
+            return false;
+        const auto axes_values = axes->cast_vector<int64_t>();
+        return axes_values.size() == 1 &&
+               (axes_values[0] < 0 ? axes_values[0] + innermost_axis + 1 : axes_values[0]) == innermost_axis;
+    }
+    return false;
+}
+
+auto is_supported_low_precision(const element::Type& type) -> bool {
+    return type == element::bf16 || type == element::i8 || type == element::u8;
+}
+
+// Convert is executed as a part of Load or Store, so only conversions between f32 and low precision are supported.
+// Moreover, low precision tensors must stay on subgraph boundaries, so f32 -> low precision Convert can't feed another Convert.
+// Stores round to nearest, while Convert truncates f32 -> integer, so only f32 -> bf16 Convert is fused into Store
+auto is_supported_convert(const std::shared_ptr<const Node> &n) -> bool {
+    if (!ov::is_type<const opset1::Convert>(n))
+        return false;
+    const auto& src_type = n->get_input_element_type(0);
+    const auto& dst_type = n->get_output_element_type(0);
+    if (is_supported_low_precision(src_type) && dst_type == element::f32)
+        return true;
+    if (src_type == element::f32 && dst_type == element::bf16) {
+        const auto consumers = n->get_users();
+        return std::none_of(consumers.begin(), consumers.end(), [](const std::shared_ptr<Node>& consumer) {
+            return ov::is_type<opset1::Convert>(consumer);
+        });
+    }
+    return false;
+}
+
+auto is_convert_from_low_precision(const std::shared_ptr<const Node> &n) -> bool {
+    return ov::is_type<const opset1::Convert>(n) && is_supported_low_precision(n->get_input_element_type(0));
+}
+
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
-    auto supported = [](descriptor::Tensor& t) -> bool {
-        return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+    // Dynamic dimensions are supported: the kernel gets work amounts and offsets in runtime,
+    // but the rank must be known to canonicalize the shapes
+    const bool is_convert = is_supported_convert(n);
+    auto supported = [is_convert](descriptor::Tensor& t) -> bool {
+        return (t.get_element_type() == ngraph::element::f32 ||
+                (is_convert && is_supported_low_precision(t.get_element_type()))) &&
+               t.get_partial_shape().rank().is_static();
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -170,7 +238,15 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    if (is_supported_reduction(node)) {
+        // MVN axes are constant and are dropped during decomposition, so only the data input is checked
+        const auto outputs = node->outputs();
+        return node->get_input_element_type(0) == ngraph::element::f32 &&
+               std::all_of(outputs.begin(), outputs.end(), [](const Output<const Node>& out) {
+                   return out.get_element_type() == ngraph::element::f32;
+               });
+    }
+    return (is_layout_oblivious(node) || is_supported_convert(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -321,7 +397,9 @@ TokenizeSnippets::TokenizeSnippets() {
             }
         }
         //  If there are no input subgraphs no need to go further, just create a new one.
-        if (clones.empty()) {
+        //  Convert from low precision always starts a new subgraph, otherwise it could be merged with
+        //  the producer's f32 -> low precision Convert and the low precision tensor would appear inside the body
+        if (clones.empty() || is_convert_from_low_precision(node)) {
             create_single_node_subgraph(node);
             remark(1) << "Starting subgraph at: "  << node->get_friendly_name()
                       << " with " << node->inputs().size() << " inputs and " << node->outputs().size()
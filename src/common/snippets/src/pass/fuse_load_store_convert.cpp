@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/remarks.hpp"
+
+#include "snippets/pass/fuse_load_store_convert.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+ngraph::snippets::pass::FuseLoadConvert::FuseLoadConvert() {
+    MATCHER_SCOPE(FuseLoadConvert);
+    auto load_pattern = ngraph::pattern::wrap_type<ngraph::snippets::op::Load>();
+    auto convert_pattern = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({load_pattern});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(convert_pattern, matcher_name),
+        [load_pattern](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::FuseLoadConvert")
+            const auto convert = m.get_match_root();
+            const auto load = ov::as_type_ptr<ngraph::snippets::op::Load>(m.get_pattern_value_map().at(load_pattern).get_node_shared_ptr());
+            if (!load || load->get_destination_type() != element::undefined)
+                return false;
+
+            // Load is shared by all consumers of the parameter, so it can be fused only if all of them do the same conversion
+            const auto dst_type = convert->get_output_element_type(0);
+            const auto consumers = load->get_users();
+            if (!std::all_of(consumers.begin(), consumers.end(), [&dst_type](const std::shared_ptr<Node>& consumer) {
+                    return ov::is_type<ngraph::opset1::Convert>(consumer) && consumer->get_output_element_type(0) == dst_type;
+                })) {
+                return false;
+            }
+
+            auto load_convert = std::make_shared<ngraph::snippets::op::Load>(load->input_value(0), dst_type);
+            load_convert->set_friendly_name(load->get_friendly_name());
+            ngraph::copy_runtime_info(consumers, load_convert);
+            for (const auto& consumer : consumers)
+                ngraph::replace_node(consumer, load_convert);
+            return true;
+        });
+}
+
+ngraph::snippets::pass::FuseStoreConvert::FuseStoreConvert() {
+    MATCHER_SCOPE(FuseStoreConvert);
+    auto convert_pattern = ngraph::pattern::wrap_type<ngraph::opset1::Convert>();
+    auto store_pattern = ngraph::pattern::wrap_type<ngraph::snippets::op::Store>({convert_pattern});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(store_pattern, matcher_name),
+        [convert_pattern](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::FuseStoreConvert")
+            const auto store = ov::as_type_ptr<ngraph::snippets::op::Store>(m.get_match_root());
+            const auto convert = m.get_pattern_value_map().at(convert_pattern).get_node_shared_ptr();
+            // Store rounds to nearest, while Convert truncates f32 -> integer, so only bf16 stores are fused
+            if (!store || store->get_destination_type() != element::undefined ||
+                convert->get_input_element_type(0) != element::f32 || convert->get_output_element_type(0) != element::bf16)
+                return false;
+
+            auto store_convert = std::make_shared<ngraph::snippets::op::Store>(convert->input_value(0),
+                                                                                convert->get_output_element_type(0));
+            store_convert->set_friendly_name(store->get_friendly_name());
+            ngraph::copy_runtime_info({convert, store}, store_convert);
+            ngraph::replace_node(store, store_convert);
+            return true;
+        });
+}
@@ -38,7 +38,8 @@ ngraph::snippets::pass::LoadMoveBroadcastToBroadcastLoad::LoadMoveBroadcastToBro
 
             auto inshape = root->input(0).get_shape();
             auto outshape = root->output(0).get_shape();
-            auto broadcastload = std::make_shared<snippets::op::BroadcastLoad>(param, outshape);
+            const auto load = ov::as_type_ptr<snippets::op::Load>(input);
+            auto broadcastload = std::make_shared<snippets::op::BroadcastLoad>(param, outshape, load->get_destination_type());
             Shape bct(inshape.size(), 0);
             for (size_t k = 0; k < inshape.size(); k++) {
                 if (inshape[k] != outshape[k] && inshape[k] == 1) {
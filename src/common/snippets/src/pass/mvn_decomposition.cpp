@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/remarks.hpp"
+
+#include "snippets/pass/mvn_decomposition.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+ngraph::snippets::pass::MVNDecomposition::MVNDecomposition() {
+    MATCHER_SCOPE(MVNDecomposition);
+    auto mvn = ngraph::pattern::wrap_type<ngraph::opset6::MVN>();
+
+    ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::MVNDecomposition")
+        auto root = ov::as_type_ptr<ngraph::opset6::MVN>(m.get_match_root());
+        const auto& data_shape = root->get_input_partial_shape(0);
+        const auto axes = ov::as_type_ptr<ngraph::opset1::Constant>(root->get_input_node_shared_ptr(1));
+        if (data_shape.rank().is_dynamic() || !axes)
+            return false;
+
+        const auto rank = data_shape.rank().get_length();
+        auto axes_values = axes->cast_vector<int64_t>();
+        for (auto& axis : axes_values)
+            axis = axis < 0 ? axis + rank : axis;
+        // only the innermost dimension could be reduced by a kernel
+        if (axes_values != std::vector<int64_t>{rank - 1} || data_shape[rank - 1].is_dynamic())
+            return false;
+
+        const auto data = root->input_value(0);
+        const auto type = data.get_element_type();
+        const auto reciprocal_n = ngraph::opset1::Constant::create(type, Shape{},
+                                                                   {1.f / static_cast<float>(data_shape[rank - 1].get_length())});
+        const auto mean = std::make_shared<ngraph::opset1::Multiply>(std::make_shared<ngraph::snippets::op::HorizonSum>(data), reciprocal_n);
+        const auto centered = std::make_shared<ngraph::opset1::Subtract>(data, mean);
+        std::shared_ptr<ngraph::Node> result = centered;
+
+        if (root->get_normalize_variance()) {
+            const auto squared = std::make_shared<ngraph::opset1::Multiply>(centered, centered);
+            const auto variance = std::make_shared<ngraph::opset1::Multiply>(std::make_shared<ngraph::snippets::op::HorizonSum>(squared),
+                                                                             reciprocal_n);
+            const auto eps = ngraph::opset1::Constant::create(type, Shape{}, {root->get_eps()});
+            std::shared_ptr<ngraph::Node> denominator;
+            if (root->get_eps_mode() == ngraph::op::MVNEpsMode::INSIDE_SQRT) {
+                denominator = std::make_shared<ngraph::opset1::Sqrt>(std::make_shared<ngraph::opset1::Add>(variance, eps));
+            } else {
+                denominator = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Sqrt>(variance), eps);
+            }
+            result = std::make_shared<ngraph::opset1::Divide>(centered, denominator);
+        }
+
+        result->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, result);
+        ngraph::replace_node(root, result);
+        return true;
+    };
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(mvn, matcher_name), callback);
+}
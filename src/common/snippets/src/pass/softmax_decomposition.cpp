@@ -0,0 +1,53 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/remarks.hpp"
+
+#include "snippets/pass/softmax_decomposition.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+ngraph::snippets::pass::SoftmaxDecomposition::SoftmaxDecomposition() {
+    MATCHER_SCOPE(SoftmaxDecomposition);
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>();
+
+    ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SoftmaxDecomposition")
+        auto root = m.get_match_root();
+        const auto rank = root->get_input_partial_shape(0).rank();
+        if (rank.is_dynamic())
+            return false;
+
+        int64_t axis = 0;
+        if (const auto softmax_v1 = ov::as_type_ptr<ngraph::opset1::Softmax>(root)) {
+            axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else if (const auto softmax_v8 = ov::as_type_ptr<ngraph::opset8::Softmax>(root)) {
+            axis = softmax_v8->get_axis();
+            if (axis < 0)
+                axis += rank.get_length();
+        }
+        // only the innermost dimension could be reduced by a kernel
+        if (axis != rank.get_length() - 1)
+            return false;
+
+        const auto data = root->input_value(0);
+        const auto max = std::make_shared<ngraph::snippets::op::HorizonMax>(data);
+        const auto sub = std::make_shared<ngraph::opset1::Subtract>(data, max);
+        const auto exp = std::make_shared<ngraph::opset1::Exp>(sub);
+        const auto sum = std::make_shared<ngraph::snippets::op::HorizonSum>(exp);
+        const auto div = std::make_shared<ngraph::opset1::Divide>(exp, sum);
+
+        div->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, {max, sub, exp, sum, div});
+        ngraph::replace_node(root, div);
+        return true;
+    };
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(softmax, matcher_name), callback);
+}
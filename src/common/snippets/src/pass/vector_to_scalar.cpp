@@ -20,7 +20,8 @@ ngraph::snippets::pass::ReplaceLoadsWithScalarLoads::ReplaceLoadsWithScalarLoads
             auto root = m.get_match_root();
             if (transformation_callback(root))
                 return false;
-            auto load = std::make_shared<ngraph::snippets::op::ScalarLoad> (root->input_value(0));
+            auto load = std::make_shared<ngraph::snippets::op::ScalarLoad> (root->input_value(0),
+                ov::as_type_ptr<ngraph::snippets::op::Load>(root)->get_destination_type());
             load->set_friendly_name(root->get_friendly_name());
             ngraph::copy_runtime_info(root, load);
             ngraph::replace_node(root, load);
@@ -37,7 +38,8 @@ ngraph::snippets::pass::ReplaceStoresWithScalarStores::ReplaceStoresWithScalarSt
             auto root = m.get_match_root();
             if (transformation_callback(root))
                 return false;
-            auto store = std::make_shared<ngraph::snippets::op::ScalarStore> (root->input_value(0));
+            auto store = std::make_shared<ngraph::snippets::op::ScalarStore> (root->input_value(0),
+                ov::as_type_ptr<ngraph::snippets::op::Store>(root)->get_destination_type());
             store->set_friendly_name(root->get_friendly_name());
             ngraph::copy_runtime_info(root, store);
             ngraph::replace_node(root, store);
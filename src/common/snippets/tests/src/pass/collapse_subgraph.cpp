@@ -6,6 +6,8 @@
 #include <pass/collapse_subgraph.hpp>
 #include <subgraph_simple.hpp>
 #include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/op/subgraph.hpp"
+#include <ngraph/opsets/opset1.hpp>
 
 namespace ov {
 namespace test {
@@ -39,6 +41,75 @@ TEST_F(CollapseSubgraphTests, smoke_Snippets_AvoidLoopEltwise) {
     run();
 }
 
+TEST_F(CollapseSubgraphTests, smoke_Snippets_EltwiseDynamicShapes) {
+    const PartialShape shape0{-1, -1, 16};
+    const PartialShape shape1{-1, 1, 16};
+    {
+        auto data0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape0);
+        auto data1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape1);
+        auto add = std::make_shared<ngraph::opset1::Add>(data0, data1);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        function = std::make_shared<Model>(NodeVector{relu}, ParameterVector{data0, data1});
+    }
+    {
+        auto data0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape0);
+        auto data1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape1);
+        auto indata0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape0);
+        auto indata1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape1);
+        auto add = std::make_shared<ngraph::opset1::Add>(indata0, indata1);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        auto subgraph = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{data0, data1},
+                                                                         std::make_shared<Model>(NodeVector{relu},
+                                                                                                 ParameterVector{indata0, indata1}));
+        function_ref = std::make_shared<Model>(NodeVector{subgraph}, ParameterVector{data0, data1});
+    }
+    run();
+}
+
+TEST_F(CollapseSubgraphTests, smoke_Snippets_EltwiseDynamicRank) {
+    auto data0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, PartialShape::dynamic());
+    auto data1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, PartialShape::dynamic());
+    auto add = std::make_shared<ngraph::opset1::Add>(data0, data1);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+    function = std::make_shared<Model>(NodeVector{relu}, ParameterVector{data0, data1});
+    // nodes with dynamic rank can't be canonicalized, so the model is left intact
+    function_ref = ov::clone_model(*function);
+    run();
+}
+
+TEST_F(CollapseSubgraphTests, smoke_Snippets_EltwiseSoftmax) {
+    const Shape shape{2, 3, 17};
+    {
+        auto data0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape);
+        auto data1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape);
+        auto add = std::make_shared<ngraph::opset1::Add>(data0, data1);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, 2);
+        function = std::make_shared<Model>(NodeVector{softmax}, ParameterVector{data0, data1});
+    }
+    {
+        auto data0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape);
+        auto data1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape);
+        auto indata0 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape);
+        auto indata1 = std::make_shared<ngraph::opset1::Parameter>(element::f32, shape);
+        auto add = std::make_shared<ngraph::opset1::Add>(indata0, indata1);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, 2);
+        auto subgraph = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{data0, data1},
+                                                                         std::make_shared<Model>(NodeVector{softmax},
+                                                                                                 ParameterVector{indata0, indata1}));
+        function_ref = std::make_shared<Model>(NodeVector{subgraph}, ParameterVector{data0, data1});
+    }
+    run();
+}
+
+TEST_F(CollapseSubgraphTests, smoke_Snippets_SoftmaxNotInnermostAxis) {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(element::f32, Shape{2, 3, 17});
+    auto softmax = std::make_shared<ngraph::opset1::Softmax>(data, 1);
+    function = std::make_shared<Model>(NodeVector{softmax}, ParameterVector{data});
+    // only the innermost dimension could be reduced inside a kernel
+    function_ref = ov::clone_model(*function);
+    run();
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/fuse_load_store_convert.hpp"
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+TEST_F(TransformationTestsF, SnippetsFuseLoadStoreConvert) {
+    const Shape shape{2, 3, 17};
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::u8, shape);
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto load0 = std::make_shared<snippets::op::Load>(data0);
+        auto load1 = std::make_shared<snippets::op::Load>(data1);
+        auto convert_in = std::make_shared<opset1::Convert>(load0, element::f32);
+        auto add = std::make_shared<opset1::Add>(convert_in, load1);
+        auto convert_out = std::make_shared<opset1::Convert>(add, element::bf16);
+        auto store = std::make_shared<snippets::op::Store>(convert_out);
+        function = std::make_shared<Function>(NodeVector{store}, ParameterVector{data0, data1});
+        manager.register_pass<snippets::pass::FuseLoadConvert>();
+        manager.register_pass<snippets::pass::FuseStoreConvert>();
+    }
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::u8, shape);
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto load0 = std::make_shared<snippets::op::Load>(data0, element::f32);
+        auto load1 = std::make_shared<snippets::op::Load>(data1);
+        auto add = std::make_shared<opset1::Add>(load0, load1);
+        auto store = std::make_shared<snippets::op::Store>(add, element::bf16);
+        function_ref = std::make_shared<Function>(NodeVector{store}, ParameterVector{data0, data1});
+    }
+}
+
+TEST_F(TransformationTestsF, SnippetsFuseLoadConvertSharedLoad) {
+    const Shape shape{2, 3, 17};
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::i8, shape);
+        auto load = std::make_shared<snippets::op::Load>(data);
+        auto convert0 = std::make_shared<opset1::Convert>(load, element::f32);
+        auto convert1 = std::make_shared<opset1::Convert>(load, element::f32);
+        auto mul = std::make_shared<opset1::Multiply>(convert0, convert1);
+        auto store = std::make_shared<snippets::op::Store>(mul);
+        function = std::make_shared<Function>(NodeVector{store}, ParameterVector{data});
+        manager.register_pass<snippets::pass::FuseLoadConvert>();
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::i8, shape);
+        auto load = std::make_shared<snippets::op::Load>(data, element::f32);
+        auto mul = std::make_shared<opset1::Multiply>(load, load);
+        auto store = std::make_shared<snippets::op::Store>(mul);
+        function_ref = std::make_shared<Function>(NodeVector{store}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, SnippetsFuseStoreConvertToIntegerIsSkipped) {
+    const Shape shape{2, 3, 17};
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto load = std::make_shared<snippets::op::Load>(data);
+        auto convert = std::make_shared<opset1::Convert>(load, element::u8);
+        auto store = std::make_shared<snippets::op::Store>(convert);
+        function = std::make_shared<Function>(NodeVector{store}, ParameterVector{data});
+        manager.register_pass<snippets::pass::FuseStoreConvert>();
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/softmax_decomposition.hpp"
+#include "snippets/pass/mvn_decomposition.hpp"
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+TEST_F(TransformationTestsF, SnippetsSoftmaxDecomposition) {
+    const Shape shape{2, 3, 17};
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto softmax = std::make_shared<opset1::Softmax>(data, 2);
+        function = std::make_shared<Function>(NodeVector{softmax}, ParameterVector{data});
+        manager.register_pass<snippets::pass::SoftmaxDecomposition>();
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto max = std::make_shared<snippets::op::HorizonMax>(data);
+        auto sub = std::make_shared<opset1::Subtract>(data, max);
+        auto exp = std::make_shared<opset1::Exp>(sub);
+        auto sum = std::make_shared<snippets::op::HorizonSum>(exp);
+        auto div = std::make_shared<opset1::Divide>(exp, sum);
+        function_ref = std::make_shared<Function>(NodeVector{div}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, SnippetsMVNDecomposition) {
+    const Shape shape{2, 3, 16};
+    const float eps = 1e-5f;
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {-1});
+        auto mvn = std::make_shared<opset6::MVN>(data, axes, true, eps, op::MVNEpsMode::INSIDE_SQRT);
+        function = std::make_shared<Function>(NodeVector{mvn}, ParameterVector{data});
+        manager.register_pass<snippets::pass::MVNDecomposition>();
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto reciprocal_n = opset1::Constant::create(element::f32, Shape{}, {1.f / 16});
+        auto mean = std::make_shared<opset1::Multiply>(std::make_shared<snippets::op::HorizonSum>(data), reciprocal_n);
+        auto centered = std::make_shared<opset1::Subtract>(data, mean);
+        auto squared = std::make_shared<opset1::Multiply>(centered, centered);
+        auto variance = std::make_shared<opset1::Multiply>(std::make_shared<snippets::op::HorizonSum>(squared), reciprocal_n);
+        auto denominator = std::make_shared<opset1::Sqrt>(
+                std::make_shared<opset1::Add>(variance, opset1::Constant::create(element::f32, Shape{}, {eps})));
+        auto div = std::make_shared<opset1::Divide>(centered, denominator);
+        function_ref = std::make_shared<Function>(NodeVector{div}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, SnippetsMVNDecompositionDynamicInnermostDim) {
+    auto data = std::make_shared<opset1::Parameter>(element::f32, PartialShape{2, 3, -1});
+    auto axes = opset1::Constant::create(element::i64, Shape{1}, {2});
+    auto mvn = std::make_shared<opset6::MVN>(data, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    function = std::make_shared<Function>(NodeVector{mvn}, ParameterVector{data});
+    manager.register_pass<snippets::pass::MVNDecomposition>();
+    // 1/N can't be computed for a dynamic dimension, so MVN is left intact
+    function_ref = ov::clone_model(*function);
+}
@@ -137,3 +137,123 @@ TEST(TransformationTests, AssignRegisters2) {
         ASSERT_EQ(total_ops, ref_registers.size());
     }
 }
+
+TEST(TransformationTests, AssignRegistersHorizon) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1});
+        auto y00 = std::make_shared<snippets::isa::Load>(p0); y00->set_friendly_name("y00");
+        auto y01 = std::make_shared<snippets::isa::HorizonMax>(y00); y01->set_friendly_name("y01");
+        auto y02 = std::make_shared<opset1::Subtract>(y00, y01); y02->set_friendly_name("y02");
+        auto y03 = std::make_shared<opset1::Exp>(y02); y03->set_friendly_name("y03");
+        auto y04 = std::make_shared<snippets::isa::HorizonSum>(y03); y04->set_friendly_name("y04");
+        auto y05 = std::make_shared<opset1::Divide>(y03, y04); y05->set_friendly_name("y05");
+        auto y06 = std::make_shared<snippets::isa::Store>(y05);
+
+        f = std::make_shared<Function>(NodeVector{y06}, ParameterVector{p0});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AssignRegisters>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    // producers of horizontal reductions are emitted again in the following passes,
+    // so reduction results must have registers which are not used by any other operation
+    {
+        std::map<std::string, size_t> ref_horizon_registers {{"y01", 15}, {"y04", 14}};
+        for (auto& op : f->get_ordered_ops()) {
+            auto& rt = op->get_rt_info();
+            auto it_rinfo = rt.find("reginfo");
+            if (it_rinfo == rt.end() || ov::is_type<snippets::isa::Store>(op))
+                continue;
+            auto reg = it_rinfo->second.as<std::vector<size_t>>()[0];
+            if (ref_horizon_registers.count(op->get_friendly_name())) {
+                ASSERT_EQ(ref_horizon_registers[op->get_friendly_name()], reg);
+            } else {
+                ASSERT_LT(reg, 14);
+            }
+        }
+    }
+}
+
+namespace {
+// Emulates register file and stack slots to check that every operation reads what its producer has computed
+void check_spilled_allocation(const std::shared_ptr<Function>& f, size_t reg_count) {
+    std::map<size_t, Node*> vregs;
+    std::map<int64_t, Node*> slots;
+    for (auto& op : f->get_ordered_ops()) {
+        auto& rt = op->get_rt_info();
+        if (ov::is_type<opset1::Parameter>(op) || ov::is_type<opset1::Result>(op) || rt.count("rematerialize"))
+            continue;
+        const auto it_in = rt.find("reginfoIn");
+        std::vector<std::pair<Node*, size_t>> inputs;
+        for (const auto& input : op->input_values()) {
+            auto& producer_rt = input.get_node()->get_rt_info();
+            if (!producer_rt.count("reginfo"))
+                continue;
+            const auto reg = it_in != rt.end() ? it_in->second.as<std::vector<size_t>>()[inputs.size()]
+                                               : producer_rt["reginfo"].as<std::vector<size_t>>()[0];
+            if (producer_rt.count("rematerialize")) {
+                vregs[reg] = input.get_node();
+            } else if (producer_rt.count("spillSlot")) {
+                ASSERT_EQ(slots[producer_rt["spillSlot"].as<int64_t>()], input.get_node());
+                vregs[reg] = input.get_node();
+            }
+            inputs.emplace_back(input.get_node(), reg);
+        }
+        for (const auto& input : inputs)
+            ASSERT_EQ(vregs[input.second], input.first);
+
+        const auto it_out = rt.find("reginfo");
+        if (it_out == rt.end())
+            continue;
+        const auto reg = it_out->second.as<std::vector<size_t>>()[0];
+        ASSERT_LT(reg, reg_count);
+        vregs[reg] = op.get();
+        if (rt.count("spillSlot"))
+            slots[rt["spillSlot"].as<int64_t>()] = op.get();
+    }
+}
+} // namespace
+
+TEST(TransformationTests, AssignRegistersSpill) {
+    // AVX2 and AVX-512 register files
+    for (size_t reg_count : {16, 32}) {
+        std::shared_ptr<Function> f(nullptr);
+        {
+            // all the loads are alive till the end, so they don't fit into registers
+            const size_t num_loads = 40;
+            auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1});
+            auto c0 = std::make_shared<snippets::isa::Scalar>(element::f32, Shape{1}, 2.f);
+            NodeVector loads;
+            for (size_t i = 0; i < num_loads; i++)
+                loads.push_back(std::make_shared<snippets::isa::Load>(p0));
+            std::shared_ptr<Node> y = std::make_shared<opset1::Multiply>(loads[0], c0);
+            for (size_t i = 1; i < num_loads; i++)
+                y = std::make_shared<opset1::Multiply>(y, loads[i]);
+            for (size_t i = num_loads; i > 0; i--)
+                y = std::make_shared<opset1::Add>(y, loads[i - 1]);
+            y = std::make_shared<opset1::Add>(y, c0);
+            auto store = std::make_shared<snippets::isa::Store>(y);
+
+            f = std::make_shared<Function>(NodeVector{store}, ParameterVector{p0});
+
+            pass::Manager m;
+            m.register_pass<pass::InitNodeInfo>();
+            m.register_pass<snippets::pass::AssignRegisters>(reg_count);
+            m.run_passes(f);
+            ASSERT_NO_THROW(check_rt_info(f));
+        }
+
+        size_t num_spilled = 0;
+        for (auto& op : f->get_ordered_ops()) {
+            num_spilled += op->get_rt_info().count("spillSlot");
+            if (ov::is_type<snippets::isa::Scalar>(op))
+                ASSERT_TRUE(op->get_rt_info().count("rematerialize"));
+        }
+        ASSERT_GT(num_spilled, 0);
+        check_spilled_allocation(f, reg_count);
+    }
+}
@@ -52,10 +52,12 @@ bool has_op_with_type(const std::shared_ptr<const ngraph::Function>& function) {
     return false;
 }
 
+// Compressed only (FP16) IR is detected by the decompression Converts from f16, the low precision integer
+// weights are marked as decompression too, but they don't require the conversion to the legacy representation
 inline bool has_decompression_converts(const std::shared_ptr<const ngraph::Function>& function) {
     for (const auto& op : function->get_ops()) {
         if (std::dynamic_pointer_cast<ngraph::opset8::Convert>(op)) {
-            if (ov::is_decompression(op))
+            if (ov::is_decompression(op) && op->get_input_element_type(0) == ngraph::element::f16)
                 return true;
         }
     }
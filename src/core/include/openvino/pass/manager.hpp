@@ -70,6 +70,15 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable incremental validation. When it is enabled, Validate pass
+    /// revalidates only the nodes whose inputs were changed since the previous validation (new sources,
+    /// element types or shapes), so the changes are propagated through their downstream nodes only.
+    /// The whole model is validated once at the end of run_passes if it was changed.
+    /// The passes which modify node attributes in place must revalidate such nodes by themselves.
+    /// It is disabled by default, OV_ENABLE_INCREMENTAL_VALIDATION environment variable enables it for all the managers.
+    /// \param new_state Value "true" enables incremental validation; "false", otherwise
+    void set_incremental_validation(bool new_state);
+
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -123,6 +132,7 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_validation = false;
 };
 }  // namespace pass
 }  // namespace ov
@@ -550,7 +550,7 @@ bool ov::Node::match_node(ngraph::pattern::Matcher* matcher, const Output<Node>&
     // Not exact matching allows using base classes in the patterns and successfully matching such
     // patterns
     // with sub-graph of descent nodes types.
-    if (graph_value.get_node_shared_ptr()->get_type_info().is_castable(get_type_info()) &&
+    if (graph_value.get_node()->get_type_info().is_castable(get_type_info()) &&
         matcher->match_arguments(this, graph_value.get_node_shared_ptr())) {
         auto& pattern_map = matcher->get_pattern_value_map();
         pattern_map[shared_from_this()] = graph_value;
@@ -20,6 +20,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
@@ -32,6 +33,82 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+// Revalidates only the nodes whose inputs changed since the previous run. The nodes are visited
+// in topological order, so a node which changed its outputs makes its consumers revalidated too.
+class IncrementalValidator {
+public:
+    explicit IncrementalValidator(const std::shared_ptr<ov::Model>& model) {
+        // the model is expected to be valid before the first pass
+        for (const auto& node : model->get_ordered_ops()) {
+            update_state(node);
+        }
+    }
+
+    size_t run(const std::shared_ptr<ov::Model>& model) {
+        size_t revalidated = 0;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (is_changed(node)) {
+                node->revalidate_and_infer_types();
+                update_state(node);
+                revalidated++;
+            }
+        }
+        return revalidated;
+    }
+
+private:
+    struct InputState {
+        const ov::Node* source;
+        size_t index;
+        ov::element::Type element_type;
+        ov::PartialShape shape;
+    };
+
+    struct NodeState {
+        std::weak_ptr<ov::Node> node;
+        std::vector<InputState> inputs;
+    };
+
+    static std::vector<InputState> get_inputs(const std::shared_ptr<ov::Node>& node) {
+        std::vector<InputState> inputs;
+        inputs.reserve(node->get_input_size());
+        for (const auto& input : node->inputs()) {
+            const auto& source = input.get_source_output();
+            inputs.push_back({source.get_node(), source.get_index(), input.get_element_type(), input.get_partial_shape()});
+        }
+        return inputs;
+    }
+
+    bool is_changed(const std::shared_ptr<ov::Node>& node) const {
+        // the nodes without inputs are cheap to validate and may have element type or shape changed in place,
+        // the bodies of the subgraph operations are not tracked
+        if (node->get_input_size() == 0 || ov::is_type<ov::op::util::MultiSubGraphOp>(node))
+            return true;
+        const auto it = m_states.find(node.get());
+        // the address may belong to a node which was destroyed
+        if (it == m_states.end() || it->second.node.lock() != node)
+            return true;
+        const auto& inputs = it->second.inputs;
+        if (inputs.size() != node->get_input_size())
+            return true;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            const auto input = node->input(i);
+            const auto& source = input.get_source_output();
+            if (inputs[i].source != source.get_node() || inputs[i].index != source.get_index() ||
+                inputs[i].element_type != input.get_element_type() ||
+                inputs[i].shape != input.get_partial_shape())
+                return true;
+        }
+        return false;
+    }
+
+    void update_state(const std::shared_ptr<ov::Node>& node) {
+        m_states[node.get()] = NodeState{node, get_inputs(node)};
+    }
+
+    std::unordered_map<const ov::Node*, NodeState> m_states;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -49,18 +126,38 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_incremental_validation(bool new_state) {
+    m_incremental_validation = new_state;
+}
+
 void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Manager::run_passes");
 
     static bool profile_enabled =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    static bool incremental_validation_enabled = ov::util::getenv_bool("OV_ENABLE_INCREMENTAL_VALIDATION");
 
     size_t index = 0;
     ngraph::stopwatch pass_timer;
     ngraph::stopwatch overall_timer;
+    ngraph::stopwatch validation_timer;
     overall_timer.start();
     bool function_changed = false;
+    // the managers without Validate passes don't pay for the validation state collection
+    const bool incremental_validation =
+        (m_incremental_validation || incremental_validation_enabled) &&
+        std::any_of(m_pass_list.begin(), m_pass_list.end(), [](const std::shared_ptr<PassBase>& pass) {
+            return dynamic_pointer_cast<Validate>(pass) != nullptr;
+        });
+    std::unique_ptr<IncrementalValidator> incremental_validator;
+    if (incremental_validation) {
+        validation_timer.start();
+        incremental_validator.reset(new IncrementalValidator(func));
+        validation_timer.stop();
+    }
+    bool needs_final_validation = false;
+    size_t revalidated_nodes = 0;
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -93,7 +190,14 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (function_changed) {
-                    function_pass->run_on_model(func);
+                    validation_timer.start();
+                    if (incremental_validation) {
+                        revalidated_nodes += incremental_validator->run(func);
+                        needs_final_validation = true;
+                    } else {
+                        function_pass->run_on_model(func);
+                    }
+                    validation_timer.stop();
                     function_changed = false;
                 }
             } else {
@@ -129,8 +233,20 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
     }
+    if (needs_final_validation) {
+        validation_timer.start();
+        func->validate_nodes_and_infer_types();
+        validation_timer.stop();
+    }
     if (profile_enabled) {
-        cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        cout << "passes done in " << overall_timer.get_milliseconds() << "ms, validation "
+             << validation_timer.get_total_milliseconds() << "ms";
+        if (incremental_validation) {
+            cout << " (incremental: " << revalidated_nodes << " nodes revalidated)";
+        } else {
+            cout << " (full)";
+        }
+        cout << "\n";
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
@@ -103,10 +103,7 @@ bool Matcher::is_contained_match(const NodeVector& exclusions, bool ignore_unuse
 }
 
 bool Matcher::match_value(const ngraph::Output<Node>& pattern_value, const ngraph::Output<Node>& graph_value) {
-    std::shared_ptr<Node> pattern_node = pattern_value.get_node_shared_ptr();
-    std::shared_ptr<Node> graph_node = graph_value.get_node_shared_ptr();
-
-    return pattern_node->match_value(this, pattern_value, graph_value);
+    return pattern_value.get_node()->match_value(this, pattern_value, graph_value);
 }
 
 bool Matcher::match_permutation(const OutputVector& pattern_args, const OutputVector& args) {
@@ -121,15 +118,15 @@ bool Matcher::match_permutation(const OutputVector& pattern_args, const OutputVe
 bool Matcher::match_arguments(Node* pattern_node, const std::shared_ptr<Node>& graph_node) {
     NGRAPH_DEBUG << "[MATCHER] Match arguments at " << *graph_node << " for pattern " << *pattern_node;
 
-    auto args = graph_node->input_values();
-    auto pattern_args = pattern_node->input_values();
-
-    if (args.size() != pattern_args.size()) {
+    const size_t input_size = graph_node->get_input_size();
+    if (input_size != pattern_node->get_input_size()) {
         NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
         return false;
     }
 
     if (ngraph::op::is_commutative(graph_node)) {
+        auto args = graph_node->input_values();
+        auto pattern_args = pattern_node->input_values();
         // TODO: [nikolayk] we don't really have to use lexicographically-based perms,
         // heap's algo should be faster
         std::sort(begin(pattern_args),
@@ -149,7 +146,13 @@ bool Matcher::match_arguments(Node* pattern_node, const std::shared_ptr<Node>& g
                                       return n1 < n2;
                                   }));
     } else {
-        return match_permutation(pattern_args, args);
+        // match inputs in place, without materializing input value vectors on every attempt
+        for (size_t i = 0; i < input_size; i++) {
+            if (!match_value(pattern_node->input_value(i), graph_node->input_value(i))) {
+                return false;
+            }
+        }
+        return true;
     }
 
     NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
@@ -17,7 +17,7 @@ bool pattern::op::WrapType::match_value(Matcher* matcher,
     if (std::any_of(m_wrapped_types.begin(),
                     m_wrapped_types.end(),
                     [&](const NodeTypeInfo& type_info) {
-                        return graph_value.get_node_shared_ptr()->get_type_info().is_castable(type_info);
+                        return graph_value.get_node()->get_type_info().is_castable(type_info);
                     }) &&
         m_predicate(graph_value)) {
         auto& pattern_map = matcher->get_pattern_value_map();
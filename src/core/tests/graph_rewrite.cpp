@@ -8,6 +8,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -265,6 +267,70 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndUntypedMatcherPassOrder1) {
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+}
+
+TEST(GraphRewriteTest, TypeBasedAndUntypedMatcherPassOrder2) {
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, UntypedMatcherPassRunsOnEveryNode) {
+    auto f = get_function();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>();
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(order, f->get_ordered_ops());
+}
+
+class OrRootTestPass : public ngraph::pass::MatcherPass {
+public:
+    OrRootTestPass(NodeVector& matched) : MatcherPass() {
+        auto divide = ngraph::pattern::wrap_type<opset3::Divide>();
+        auto relu = ngraph::pattern::wrap_type<opset3::Relu>();
+        auto root = std::make_shared<ngraph::pattern::op::Or>(OutputVector{divide, relu});
+        ngraph::matcher_pass_callback callback = [&matched](pattern::Matcher& m) {
+            matched.push_back(m.get_match_root());
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(root, "OrRootTestPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, OrRootMatcherPass) {
+    auto f = get_function();
+
+    NodeVector matched;
+    Anchor anchor;
+    anchor.add_matcher<OrRootTestPass>(matched);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(matched.size(), 1);
+    ASSERT_TRUE(ov::is_type<opset3::Divide>(matched[0]));
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
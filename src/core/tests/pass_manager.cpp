@@ -42,3 +42,56 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class ReplaceParameterPass : public pass::FunctionPass {
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        auto parameter = f->get_parameters()[0];
+        auto new_parameter = std::make_shared<op::Parameter>(element::f32, PartialShape{4, 5});
+        replace_node(parameter, new_parameter);
+        f->replace_parameter(0, new_parameter);
+        return true;
+    }
+};
+}  // namespace
+
+namespace {
+// Records the output shapes of the model as they are seen by the passes between the validations
+class RecordShapesPass : public pass::FunctionPass {
+public:
+    explicit RecordShapesPass(std::vector<PartialShape>& shapes) : m_shapes(shapes) {}
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        m_shapes.clear();
+        for (const auto& node : f->get_ordered_ops()) {
+            m_shapes.push_back(node->get_output_partial_shape(0));
+        }
+        return false;
+    }
+
+private:
+    std::vector<PartialShape>& m_shapes;
+};
+}  // namespace
+
+TEST(pass_manager, incremental_validation_propagates_changes) {
+    for (bool incremental : {true, false}) {
+        auto parameter = std::make_shared<op::Parameter>(element::f32, PartialShape{2, 3});
+        auto relu = std::make_shared<op::Relu>(parameter);
+        auto abs = std::make_shared<op::Abs>(relu);
+        auto f = std::make_shared<Function>(NodeVector{abs}, ParameterVector{parameter});
+
+        // the shapes are checked before the final validation of run_passes, so they show
+        // what the validation between the passes propagated
+        std::vector<PartialShape> shapes;
+        pass::Manager pass_manager;
+        pass_manager.set_incremental_validation(incremental);
+        pass_manager.register_pass<ReplaceParameterPass>();
+        pass_manager.register_pass<RecordShapesPass>(shapes);
+        pass_manager.run_passes(f);
+
+        // parameter, relu, abs, result
+        EXPECT_EQ(shapes, std::vector<PartialShape>(4, PartialShape{4, 5})) << "incremental: " << incremental;
+        EXPECT_EQ(f->get_output_partial_shape(0), (PartialShape{4, 5}));
+    }
+}
@@ -40,7 +40,11 @@ protected:
     bool supported_impl(const std::vector<ov::Any>& variants) const override;
 
     /// \brief Reads model from file or std::istream
-    /// \param params Can be path to the model file or std::istream
+    /// \param params Can be path to the model file or std::istream, followed by the path to the weights file
+    /// or the weights buffer, and by ov::AnyMap properties. The weights file is read into memory, pass
+    /// ov::enable_mmap(true) in the properties to memory map it instead, so that Constants are views into the file
+    /// and only the pages they are read from get loaded. The mapped file must not be modified or truncated while the
+    /// model is alive.
     /// \return InputModel::Ptr
     InputModel::Ptr load_impl(const std::vector<ov::Any>& params) const override;
 
@@ -12,6 +12,7 @@
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/util/file_util.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
@@ -115,6 +116,9 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ngraph::runtime::AlignedBuffer> weights;
+    // the mapping breaks (SIGBUS on access) if the weights file is overwritten or truncated while the model is alive,
+    // so it is used only on request with ov::enable_mmap
+    bool enable_mmap = false;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -179,6 +183,11 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 #endif
         } else if (variant.is<std::shared_ptr<ngraph::runtime::AlignedBuffer>>()) {
             weights = variant.as<std::shared_ptr<ngraph::runtime::AlignedBuffer>>();
+        } else if (variant.is<ov::AnyMap>()) {
+            const auto& properties = variant.as<ov::AnyMap>();
+            const auto it = properties.find(ov::enable_mmap.name());
+            if (it != properties.end())
+                enable_mmap = it->second.as<bool>();
         }
     }
 
@@ -197,7 +206,11 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             weights_path.clear();
         }
     }
-    if (!weights_path.empty()) {
+    if (!weights_path.empty() && enable_mmap) {
+        // Constants become views into the mapping, so the weights are paged in only when they are accessed
+        // (e.g. by the plugin during compilation) and are never copied to the heap
+        weights = ov::load_mmap_object(weights_path);
+    } else if (!weights_path.empty()) {
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
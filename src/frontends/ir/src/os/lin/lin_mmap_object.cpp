@@ -89,7 +89,7 @@ public:
     }
 
     char* data() noexcept {
-        return static_cast<char*>(m_data);
+        return m_data == MAP_FAILED ? nullptr : static_cast<char*>(m_data);
     }
 
     size_t size() const noexcept {
@@ -5,6 +5,7 @@
 #include "decoder_proto.hpp"
 
 #include "attr_value.pb.h"
+#include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "types.pb.h"
@@ -29,8 +30,36 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
     return type_map;
 }
 
+// Hands out the tensor_content buffer of the GraphDef, so the tensor is a view over it
+// which keeps the whole GraphDef alive
+class TensorContentAllocator : public ov::AllocatorImpl {
+public:
+    TensorContentAllocator(const std::string& tensor_content, const std::shared_ptr<::tensorflow::GraphDef>& graph_def)
+        : m_tensor_content(tensor_content),
+          m_graph_def(graph_def) {}
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        FRONT_END_GENERAL_CHECK(bytes <= m_tensor_content.size(), "Size of tensor exceeds tensor_content size.");
+        return const_cast<char*>(m_tensor_content.data());
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        auto other_allocator = dynamic_cast<const TensorContentAllocator*>(&other);
+        return other_allocator != nullptr && other_allocator->m_tensor_content.data() == m_tensor_content.data();
+    }
+
+private:
+    const std::string& m_tensor_content;
+    std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
+};
+
 template <typename T>
-void extract_tensor_content(const std::string& tensor_content, ov::Tensor* values) {
+ov::Tensor extract_tensor_content(const std::string& tensor_content,
+                                  const ov::element::Type& ov_type,
+                                  const ov::Shape& shape,
+                                  const std::shared_ptr<::tensorflow::GraphDef>& graph_def) {
     const auto tensor_content_size = tensor_content.size();
     FRONT_END_GENERAL_CHECK(tensor_content_size % sizeof(T) == 0,
                             "Size of tensor_content (",
@@ -39,9 +68,17 @@ void extract_tensor_content(const std::string& tensor_content, ov::Tensor* value
                             sizeof(T));
 
     const T* tensor_values = reinterpret_cast<const T*>(tensor_content.data());
-    FRONT_END_GENERAL_CHECK(values->get_size() == tensor_content_size / sizeof(T),
+    FRONT_END_GENERAL_CHECK(ov::shape_size(shape) == tensor_content_size / sizeof(T),
                             "Size of tensor is not equal to tensor_content size.");
-    std::copy(tensor_values, tensor_values + tensor_content_size / sizeof(T), values->data<T>());
+    // the data is shared only if the decoder owns the graph and the content is suitably aligned to be read as T
+    if (graph_def && reinterpret_cast<uintptr_t>(tensor_values) % alignof(T) == 0) {
+        return ov::Tensor(ov_type,
+                          shape,
+                          ov::Allocator(std::make_shared<TensorContentAllocator>(tensor_content, graph_def)));
+    }
+    ov::Tensor values(ov_type, shape);
+    std::copy(tensor_values, tensor_values + tensor_content_size / sizeof(T), values.data<T>());
+    return values;
 }
 
 template <typename T>
@@ -90,18 +127,18 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attrs[0]->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attrs[0]->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attrs[0]->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attrs[0]->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attrs[0]->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
         std::vector<ov::Dimension> dims;
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attrs[0]->shape();
         for (int i = 0; i < tf_shape.dim_size(); i++) {
             dims.emplace_back(tf_shape.dim(i).size());
         }
@@ -109,8 +146,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attrs[0]->type())) {
+            return TYPE_MAP().at(attrs[0]->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -118,7 +155,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attrs[0]->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -164,7 +201,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attrs[0]->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -176,41 +213,42 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
-        ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
+        ov::Tensor res;
+        const auto& tensor_content = tensor_proto.tensor_content();
         if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
-                extract_tensor_content<uint8_t>(tensor_content, &res);
+                res = extract_tensor_content<uint8_t>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::i8:
-                extract_tensor_content<int8_t>(tensor_content, &res);
+                res = extract_tensor_content<int8_t>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::i16:
-                extract_tensor_content<int16_t>(tensor_content, &res);
+                res = extract_tensor_content<int16_t>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::i32:
-                extract_tensor_content<int32_t>(tensor_content, &res);
+                res = extract_tensor_content<int32_t>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::i64:
-                extract_tensor_content<int64_t>(tensor_content, &res);
+                res = extract_tensor_content<int64_t>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::f16:
-                extract_tensor_content<float16>(tensor_content, &res);
+                res = extract_tensor_content<float16>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::f32:
-                extract_tensor_content<float>(tensor_content, &res);
+                res = extract_tensor_content<float>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::f64:
-                extract_tensor_content<double>(tensor_content, &res);
+                res = extract_tensor_content<double>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             case ov::element::bf16:
-                extract_tensor_content<bfloat16>(tensor_content, &res);
+                res = extract_tensor_content<bfloat16>(tensor_content, ov_type, pshape.get_shape(), m_graph_def);
                 break;
             default:
                 FRONT_END_THROW("Encountered unknown element type " + ov_type.get_type_name());
             }
         } else {
+            res = ov::Tensor(ov_type, pshape.get_shape());
             int64_t val_size = 0;
             switch (ov_type) {
             case ov::element::boolean:
@@ -285,11 +323,11 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
+std::vector<const ::tensorflow::AttrValue*> DecoderProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    auto it = attr_map.find(name);
+    if (it != attr_map.end()) {
+        return {&it->second};
     } else {
         return {};
     }
@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "openvino/frontend/tensorflow/decoder.hpp"
 
 namespace tensorflow {
+class GraphDef;
 class NodeDef;
 class AttrValue;
 }  // namespace tensorflow
@@ -22,6 +24,12 @@ class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
     explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
 
+    /// \brief Constructs the decoder which shares the ownership of the graph containing the node.
+    /// The tensor attributes are returned as views over the graph's tensor_content without copying.
+    DecoderProto(const ::tensorflow::NodeDef* node_def, const std::shared_ptr<::tensorflow::GraphDef>& graph_def)
+        : m_node_def(node_def),
+          m_graph_def(graph_def) {}
+
     ov::Any get_attribute(const std::string& name) const override;
 
     size_t get_input_size() const override;
@@ -35,8 +43,9 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    std::vector<const ::tensorflow::AttrValue*> decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
 };
 }  // namespace tensorflow
 }  // namespace frontend
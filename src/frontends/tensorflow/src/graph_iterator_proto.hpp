@@ -55,7 +55,7 @@ public:
 
     /// Return NodeContext for the current node that iterator points to
     std::shared_ptr<DecoderBase> get_decoder() const override {
-        return std::make_shared<DecoderProto>(m_nodes[node_index]);
+        return std::make_shared<DecoderProto>(m_nodes[node_index], m_graph_def);
     }
 };
 
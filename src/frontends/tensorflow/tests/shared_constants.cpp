@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov::frontend;
+
+namespace {
+std::shared_ptr<ov::opset8::Constant> get_constant(const std::shared_ptr<ov::Model>& model, const std::string& name) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (node->get_friendly_name() == name)
+            return std::dynamic_pointer_cast<ov::opset8::Constant>(node);
+    }
+    return nullptr;
+}
+
+std::vector<float> range(size_t size, float step) {
+    std::vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+        values[i] = static_cast<float>(i) * step;
+    return values;
+}
+
+InputModel::Ptr load_shared_constants_model(FrontEndManager& fem, FrontEnd::Ptr& frontEnd) {
+    frontEnd = fem.load_by_framework(TF_FE);
+    auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                             std::string("shared_constants/shared_constants.pb"));
+    return frontEnd->load(model_filename);
+}
+}  // namespace
+
+TEST(TFSharedConstantsTest, constants_outlive_input_model) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(inputModel = load_shared_constants_model(fem, frontEnd));
+    ASSERT_NE(inputModel, nullptr);
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+    ASSERT_NE(model, nullptr);
+
+    // the constants keep the parsed graph alive after the input model is released
+    inputModel.reset();
+    auto weights = get_constant(model, "weights");
+    auto bias = get_constant(model, "bias");
+    ASSERT_NE(weights, nullptr);
+    ASSERT_NE(bias, nullptr);
+    ASSERT_EQ(weights->get_shape(), (ov::Shape{3, 4}));
+    ASSERT_EQ(weights->cast_vector<float>(), range(12, 1.f));
+    ASSERT_EQ(bias->cast_vector<float>(), range(4, -1.f));
+}
+
+TEST(TFSharedConstantsTest, constants_alias_graph_content) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(inputModel = load_shared_constants_model(fem, frontEnd));
+    ASSERT_NE(inputModel, nullptr);
+    std::shared_ptr<ov::Model> first, second;
+    ASSERT_NO_THROW(first = frontEnd->convert(inputModel));
+    ASSERT_NO_THROW(second = frontEnd->convert(inputModel));
+    inputModel.reset();
+
+    // both models are views over the same tensor_content buffers
+    auto weights = get_constant(first, "weights");
+    auto bias = get_constant(first, "bias");
+    auto second_weights = get_constant(second, "weights");
+    ASSERT_NE(weights, nullptr);
+    ASSERT_NE(bias, nullptr);
+    ASSERT_NE(second_weights, nullptr);
+    ASSERT_EQ(weights->get_data_ptr(), second_weights->get_data_ptr());
+
+    // every constant has its own buffer
+    auto weights_begin = weights->get_data_ptr<char>();
+    auto bias_begin = bias->get_data_ptr<char>();
+    ASSERT_TRUE(weights_begin + weights->get_byte_size() <= bias_begin ||
+                bias_begin + bias->get_byte_size() <= weights_begin);
+
+    // the shared buffers stay valid while any of the models is alive
+    first.reset();
+    weights.reset();
+    bias.reset();
+    ASSERT_EQ(second_weights->cast_vector<float>(), range(12, 1.f));
+    ASSERT_EQ(get_constant(second, "bias")->cast_vector<float>(), range(4, -1.f));
+}
@@ -0,0 +1,34 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+#
+# tensorflow model with the constants stored in tensor_content
+#
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+
+def main():
+    tf.compat.v1.reset_default_graph()
+
+    # Create the graph and model
+    with tf.compat.v1.Session() as sess:
+        input = tf.compat.v1.placeholder(tf.float32, [2, 3], 'x')
+
+        weights = tf.constant(np.arange(12).reshape(3, 4), dtype=tf.float32, name="weights")
+        bias = tf.constant(-np.arange(4), dtype=tf.float32, name="bias")
+
+        matmul = tf.linalg.matmul(input, weights, name="matmul")
+        tf.add(matmul, bias, name="add")
+
+        tf.compat.v1.global_variables_initializer()
+        tf_net = sess.graph_def
+
+    tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "shared_constants"), "shared_constants.pb", False)
+
+
+if __name__ == "__main__":
+    main()
@@ -20,6 +20,20 @@
 
 namespace InferenceEngine {
 
+/**
+ * @interface IBudgetedStreamsExecutor
+ * @brief Streams executor which runs the tasks on the cores reserved from the process-wide core budget
+ * @ingroup ie_dev_api_threading
+ */
+class INFERENCE_ENGINE_API_CLASS(IBudgetedStreamsExecutor) : public IStreamsExecutor {
+public:
+    /**
+     * @brief Returns the cores the executor is currently pinned to
+     * @return Indexes of the reserved cores, empty if the streams are not pinned
+     */
+    virtual std::vector<int> getReservedCores() = 0;
+};
+
 /**
  * @interface ExecutorManager
  * @brief Interface for tasks execution manager.
@@ -46,6 +60,21 @@ public:
     /// @private
     virtual IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) = 0;
 
+    /**
+     * @brief Returns a new CPU streams executor pinned to cores reserved from a process-wide core budget
+     * @details The budget partitions the physical cores among all live budgeted executors proportionally to their
+     * weights, so several compiled models do not oversubscribe the machine. The shares are rebalanced every time an
+     * executor is created or destroyed, and every executor gets a disjoint range of core indexes while there are
+     * enough cores. The ranges are not aligned to the NUMA nodes and may span several of them. The number of streams
+     * is fixed at creation, while the threads per stream and the pinned cores follow the rebalanced share starting
+     * from the next task. The default implementation creates a regular CPU streams executor without a budget.
+     * @param config Requested executor configuration. On return it holds the granted number of streams, threads per
+     * stream and the binding offset of the first reserved core.
+     * @param weight A relative share of the cores, e.g. derived from the model priority. Zero is treated as one.
+     * @return A shared pointer to the newly created executor
+     */
+    virtual IStreamsExecutor::Ptr getBudgetedCPUStreamsExecutor(IStreamsExecutor::Config& config, unsigned weight);
+
     /**
      * @cond
      */
@@ -53,6 +82,8 @@ public:
 
     virtual size_t getIdleCPUStreamsExecutorsNumber() const = 0;
 
+    virtual size_t getBudgetedCPUStreamsExecutorsNumber() const;
+
     virtual void clear(const std::string& id = {}) = 0;
     /**
      * @endcond
@@ -40,5 +40,26 @@ namespace CPUConfigParams {
  */
 DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
+/**
+ * @brief The name for defining if the executable network reserves its cores from the process-wide core budget
+ *
+ * The budget partitions the physical cores among the executable networks loaded with this option proportionally to
+ * their priority, instead of letting every network occupy all the cores. PluginConfigParams::KEY_MODEL_PRIORITY has no
+ * effect on the CPU plugin without this option.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(CORE_BUDGET);
+
+/**
+ * @brief The name for the minimal share of zero values in the FullyConnected weights to execute it with sparse weights
+ *
+ * The weights of such layers are packed without the zero values at load time, and the layers with a small number of
+ * the input rows are executed by the sparse product.
+ * It is passed to Core::SetConfig(), this option should be used with a floating point value in [0, 1],
+ * 1 (default) disables the sparse weights
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
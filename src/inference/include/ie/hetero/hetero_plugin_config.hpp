@@ -34,5 +34,19 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of subgraphs assigned to different devices:
+ * sub-devices keep their own request queues instead of the exclusive one, so while a request runs
+ * its second subgraph the next request can already run the first one.
+ * Pipelining needs at least as many requests in flight as there are subgraphs, which is reflected by
+ * the OPTIMAL_NUMBER_OF_INFER_REQUESTS metric of the executable network. Every subgraph holds at most the
+ * OPTIMAL_NUMBER_OF_INFER_REQUESTS of its device, counting the requests which finished it and wait for the next
+ * subgraph, so a slow subgraph throttles the previous ones.
+ * CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) defaults to CONFIG_VALUE(NO) in this mode, setting it to CONFIG_VALUE(YES)
+ * together with this option is an error.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -47,5 +47,47 @@ namespace intel_cpu {
  */
 static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATION"};
 
+/**
+ * @brief This property defines whether the compiled model takes its cores from the process-wide core budget.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When several models are compiled in one process each of them by default occupies all the cores, so running them
+ * concurrently oversubscribes the CPU. With the core budget enabled the physical cores are partitioned among the
+ * compiled models with this property set, proportionally to their ov::hint::model_priority. The shares are rebalanced
+ * when a model joins or leaves the budget, so the cores of a destroyed model go to the remaining ones. The cores granted
+ * to a model can be queried with ov::intel_cpu::reserved_cores. The CPU plugin uses ov::hint::model_priority only for
+ * these shares, so without the core budget the priority has no effect.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::intel_cpu::core_budget(true),
+ *                                         ov::hint::model_priority(ov::hint::Priority::HIGH));
+ * @endcode
+ */
+static constexpr Property<bool> core_budget{"CPU_CORE_BUDGET"};
+
+/**
+ * @brief Read-only property of a compiled model to get the indices of the cores currently reserved for it from the
+ * core budget
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The list is empty if the model was compiled without ov::intel_cpu::core_budget or its streams are not pinned.
+ */
+static constexpr Property<std::vector<size_t>, PropertyMutability::RO> reserved_cores{"CPU_RESERVED_CORES"};
+
+/**
+ * @brief This property defines the minimal share of zero values in the FullyConnected weights to use sparse weights.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Pruned models often keep the dense shapes of the weights with most of the values set to zero. The weights of the
+ * FullyConnected layers with the share of zero values not less than the given rate are packed without the zero values,
+ * and the layers with a small number of the input rows read only the non zero weights. The value is in [0, 1],
+ * 1 (default) disables the sparse weights.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::intel_cpu::sparse_weights_decompression_rate(0.8f));
+ * @endcode
+ */
+static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -517,6 +517,16 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to set whether read_model memory maps the IR weights file instead of reading it
+ * value type: boolean
+ *   - True the Constants are views into the mapped file and only the pages they are read from get loaded, the file
+ *     must not be modified or truncated while the model is alive
+ *   - False (default) the weights are read into memory
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -6,6 +6,7 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -260,6 +261,12 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 executorManager()->setTbbFlag(flag);
                 config.erase(it);
             }
+
+            it = config.find(ov::enable_mmap.name());
+            if (it != config.end()) {
+                _enableMmap = it->second == CONFIG_VALUE(YES);
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
@@ -272,6 +279,10 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig._cacheDir;
         }
 
+        bool get_enable_mmap() const {
+            return _enableMmap;
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig getCacheConfigForDevice(const std::string& device_name,
@@ -318,6 +329,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+        std::atomic<bool> _enableMmap{false};
     };
 
     struct CacheContent {
@@ -631,7 +643,12 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        return InferenceEngine::details::ReadNetwork(modelPath,
+                                                     binPath,
+                                                     extensions,
+                                                     ov_extensions,
+                                                     newAPI,
+                                                     coreConfig.get_enable_mmap());
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model,
@@ -986,6 +1003,8 @@ public:
             return decltype(ov::force_tbb_terminate)::value_type(flag);
         } else if (name == ov::cache_dir.name()) {
             return ov::Any(coreConfig.get_cache_dir());
+        } else if (name == ov::enable_mmap.name()) {
+            return decltype(ov::enable_mmap)::value_type(coreConfig.get_enable_mmap());
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
@@ -32,6 +32,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_ptr.hpp"
 #include "transformations/rt_info/old_api_map_order_attribute.hpp"
@@ -417,7 +418,8 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
-                                bool newAPI) {
+                                bool newAPI,
+                                bool enableMmap) {
 #ifdef ENABLE_IR_V7_READER
     // IR v7 obsolete code
     {
@@ -462,6 +464,13 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
         FE->add_extension(ov_exts);
         if (!exts.empty())
             FE->add_extension(wrap_old_extensions(exts));
+        if (enableMmap) {
+            // passed by name only to the frontends which accept it
+            auto mmap_params = params;
+            mmap_params.emplace_back(ov::AnyMap{{ov::enable_mmap.name(), true}});
+            if (FE->supported(mmap_params))
+                params = std::move(mmap_params);
+        }
         inputModel = FE->load(params);
     }
 
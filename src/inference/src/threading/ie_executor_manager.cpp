@@ -5,6 +5,7 @@
 #include "threading/ie_executor_manager.hpp"
 
 #include "ie_parallel.hpp"
+#include "ie_system_conf.h"
 #include "threading/ie_cpu_streams_executor.hpp"
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
 #    if (TBB_INTERFACE_VERSION < 12000)
@@ -14,20 +15,269 @@
 #    endif
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <utility>
 
 namespace InferenceEngine {
 namespace {
+/**
+ * Process-wide partitioning of the physical cores between budgeted executors.
+ * The cores are split between the live reservations proportionally to their weights (capped by the requested number)
+ * every time a reservation is added or released, and the shares are laid out as disjoint contiguous windows.
+ * The windows overlap only if there are more reservations than cores.
+ */
+class CoreBudget {
+public:
+    struct Reservation {
+        unsigned weight;
+        int requested;
+        int offset;
+        int cores;
+        unsigned epoch;  // changes every time the window of the reservation is moved or resized
+    };
+    using Handle = std::list<Reservation>::iterator;
+
+    explicit CoreBudget(int cores) : _total(std::max(1, cores)) {}
+
+    Handle reserve(int requested, unsigned weight) {
+        std::lock_guard<std::mutex> guard(_mutex);
+        auto reservation =
+            _reservations.insert(_reservations.end(), Reservation{weight, std::max(1, requested), 0, 0, 0});
+        rebalance();
+        return reservation;
+    }
+
+    void release(Handle reservation) {
+        std::lock_guard<std::mutex> guard(_mutex);
+        _reservations.erase(reservation);
+        rebalance();
+    }
+
+    Reservation get(Handle reservation) const {
+        std::lock_guard<std::mutex> guard(_mutex);
+        return *reservation;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> guard(_mutex);
+        return _reservations.size();
+    }
+
+private:
+    void rebalance() {
+        const unsigned long long totalWeight = std::accumulate(_reservations.begin(),
+                                                               _reservations.end(),
+                                                               0ull,
+                                                               [](unsigned long long sum, const Reservation& r) {
+                                                                   return sum + r.weight;
+                                                               });
+        std::vector<int> shares;
+        int granted = 0;
+        for (const auto& reservation : _reservations) {
+            const int share = static_cast<int>(static_cast<unsigned long long>(_total) * reservation.weight / totalWeight);
+            shares.push_back(std::max(1, std::min(reservation.requested, share)));
+            granted += shares.back();
+        }
+        // the cores left after the rounding go to the reservations which requested more
+        for (bool added = true; added && granted < _total;) {
+            added = false;
+            auto share = shares.begin();
+            for (auto it = _reservations.begin(); it != _reservations.end() && granted < _total; ++it, ++share) {
+                if (*share < it->requested) {
+                    ++*share;
+                    ++granted;
+                    added = true;
+                }
+            }
+        }
+
+        int offset = 0;
+        auto share = shares.begin();
+        for (auto& reservation : _reservations) {
+            const int cores = std::min(*share++, _total);
+            if (offset + cores > _total)
+                offset = 0;
+            if (reservation.offset != offset || reservation.cores != cores) {
+                reservation.offset = offset;
+                reservation.cores = cores;
+                ++reservation.epoch;
+            }
+            offset += cores;
+        }
+    }
+
+    mutable std::mutex _mutex;
+    const int _total;
+    std::list<Reservation> _reservations;
+};
+
+class BudgetedStreamsExecutor;
+
+// The executor whose task is running on the current thread
+struct RunningExecutor {
+    const BudgetedStreamsExecutor* owner;
+    IStreamsExecutor* executor;
+};
+thread_local RunningExecutor runningExecutor = {nullptr, nullptr};
+
+/**
+ * Runs the tasks on a CPUStreamsExecutor pinned to the current window of the reservation. Live threads can't be
+ * re-pinned, so when the budget is rebalanced the next task starts a new executor pinned to the new window and the
+ * previous one is destroyed as soon as its tasks are finished. The number of streams is fixed at creation, since
+ * the plugins create the per-stream state for it; the threads per stream and the pinned cores follow the window.
+ */
+class BudgetedStreamsExecutor : public IBudgetedStreamsExecutor {
+public:
+    BudgetedStreamsExecutor(const Config& config,
+                            int requestedThreadsPerStream,
+                            std::shared_ptr<CoreBudget> budget,
+                            CoreBudget::Handle reservation)
+        : _config(config),
+          _requestedThreadsPerStream(requestedThreadsPerStream),
+          _budget(std::move(budget)),
+          _reservation(reservation) {
+        acquire();
+    }
+
+    ~BudgetedStreamsExecutor() override {
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            _retired.clear();
+            _current = {};
+        }
+        _budget->release(_reservation);
+    }
+
+    // the config of the executor for the given window
+    Config getConfig(const CoreBudget::Reservation& window) const {
+        auto config = _config;
+        config._threadsPerStream = std::max(1, std::min(_requestedThreadsPerStream, window.cores / config._streams));
+        config._threads = config._streams * config._threadsPerStream;
+        // the streams which don't fit into the window are not pinned, so they don't run on the cores of the others
+        config._threadBindingType =
+            window.cores >= config._streams ? ThreadBindingType::CORES : ThreadBindingType::NONE;
+        config._threadBindingStep = 1;
+        config._threadBindingOffset = window.offset;
+        return config;
+    }
+
+    std::vector<int> getReservedCores() override {
+        const auto config = getConfig(_budget->get(_reservation));
+        std::vector<int> cores;
+        if (config._threadBindingType == ThreadBindingType::CORES) {
+            for (int core = 0; core < config._threads; ++core)
+                cores.push_back(config._threadBindingOffset + core);
+        }
+        return cores;
+    }
+
+    void run(Task task) override {
+        auto instance = acquire();
+        instance.executor->run(wrap(instance, std::move(task)));
+    }
+
+    void Execute(Task task) override {
+        auto instance = acquire();
+        instance.executor->Execute(wrap(instance, std::move(task)));
+    }
+
+    int GetStreamId() override {
+        return running()->GetStreamId();
+    }
+
+    int GetNumaNodeId() override {
+        return running()->GetNumaNodeId();
+    }
+
+private:
+    struct Instance {
+        std::shared_ptr<IStreamsExecutor> executor;
+        std::shared_ptr<std::atomic<int>> pending;
+        unsigned epoch = 0;
+    };
+
+    Instance acquire() {
+        const auto window = _budget->get(_reservation);
+        std::vector<Instance> finished;
+        Instance current;
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            if (!_current.executor || _current.epoch != window.epoch) {
+                if (_current.executor)
+                    _retired.push_back(_current);
+                _current.executor = std::make_shared<CPUStreamsExecutor>(getConfig(window));
+                _current.pending = std::make_shared<std::atomic<int>>(0);
+                _current.epoch = window.epoch;
+            }
+            // the retired executors are destroyed once their tasks are finished, but never from their own threads
+            auto retired = std::partition(_retired.begin(), _retired.end(), [](const Instance& instance) {
+                return instance.pending->load() != 0 || instance.executor.get() == runningExecutor.executor;
+            });
+            std::move(retired, _retired.end(), std::back_inserter(finished));
+            _retired.erase(retired, _retired.end());
+            current = _current;
+        }
+        return current;
+    }
+
+    Task wrap(const Instance& instance, Task task) const {
+        struct Scope {
+            RunningExecutor previous;
+            std::shared_ptr<std::atomic<int>> pending;
+            ~Scope() {
+                runningExecutor = previous;
+                --*pending;
+            }
+        };
+        ++*instance.pending;
+        const auto owner = this;
+        auto executor = instance.executor.get();
+        auto pending = instance.pending;
+        return [owner, executor, pending, task] {
+            Scope scope{runningExecutor, pending};
+            runningExecutor = {owner, executor};
+            task();
+        };
+    }
+
+    // the executor running the current task, or the current one if the thread doesn't belong to this executor
+    std::shared_ptr<IStreamsExecutor> running() {
+        auto instance = acquire();
+        if (runningExecutor.owner == this) {
+            std::lock_guard<std::mutex> guard(_mutex);
+            for (const auto& retired : _retired) {
+                if (retired.executor.get() == runningExecutor.executor)
+                    return retired.executor;
+            }
+        }
+        return instance.executor;
+    }
+
+    const Config _config;
+    const int _requestedThreadsPerStream;
+    std::shared_ptr<CoreBudget> _budget;
+    CoreBudget::Handle _reservation;
+    std::mutex _mutex;
+    Instance _current;
+    std::vector<Instance> _retired;
+};
+
 class ExecutorManagerImpl : public ExecutorManager {
 public:
     ~ExecutorManagerImpl();
     ITaskExecutor::Ptr getExecutor(const std::string& id) override;
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) override;
     size_t getExecutorsNumber() const override;
+    IStreamsExecutor::Ptr getBudgetedCPUStreamsExecutor(IStreamsExecutor::Config& config, unsigned weight) override;
     size_t getIdleCPUStreamsExecutorsNumber() const override;
+    size_t getBudgetedCPUStreamsExecutorsNumber() const override;
     void clear(const std::string& id = {}) override;
     void setTbbFlag(bool flag) override;
     bool getTbbFlag() override;
@@ -37,6 +287,7 @@ private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
     mutable std::mutex streamExecutorMutex;
+    std::shared_ptr<CoreBudget> coreBudget = std::make_shared<CoreBudget>(getNumberOfCPUCores());
     mutable std::mutex taskExecutorMutex;
     bool tbbTerminateFlag = false;
     mutable std::mutex tbbMutex;
@@ -135,6 +386,23 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getBudgetedCPUStreamsExecutor(IStreamsExecutor::Config& config,
+                                                                         unsigned weight) {
+    const int streams = std::max(1, config._streams);
+    const int threadsPerStream = std::max(1, config._threadsPerStream);
+    auto reservation = coreBudget->reserve(streams * threadsPerStream, std::max(1u, weight));
+
+    // fit the streams into the granted window: keep as many streams as possible, then widen them
+    config._streams = std::min(streams, coreBudget->get(reservation).cores);
+    auto newExec = std::make_shared<BudgetedStreamsExecutor>(config, threadsPerStream, coreBudget, reservation);
+    config = newExec->getConfig(coreBudget->get(reservation));
+    {
+        std::lock_guard<std::mutex> guard(streamExecutorMutex);
+        tbbThreadsCreated = true;
+    }
+    return newExec;
+}
+
 size_t ExecutorManagerImpl::getExecutorsNumber() const {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     return executors.size();
@@ -145,6 +413,10 @@ size_t ExecutorManagerImpl::getIdleCPUStreamsExecutorsNumber() const {
     return cpuStreamsExecutors.size();
 }
 
+size_t ExecutorManagerImpl::getBudgetedCPUStreamsExecutorsNumber() const {
+    return coreBudget->size();
+}
+
 void ExecutorManagerImpl::clear(const std::string& id) {
     std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
     std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
@@ -187,6 +459,15 @@ public:
 
 }  // namespace
 
+IStreamsExecutor::Ptr ExecutorManager::getBudgetedCPUStreamsExecutor(IStreamsExecutor::Config& config, unsigned) {
+    // the managers without the budget create the executors as requested
+    return std::make_shared<CPUStreamsExecutor>(config);
+}
+
+size_t ExecutorManager::getBudgetedCPUStreamsExecutorsNumber() const {
+    return 0;
+}
+
 ExecutorManager::Ptr executorManager() {
     static ExecutorManagerHolder executorManagerHolder;
     return executorManagerHolder.get();
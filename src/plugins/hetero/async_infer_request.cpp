@@ -16,9 +16,15 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
-    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
+    const auto& subRequests = _heteroInferRequest->_inferRequests;
+    for (std::size_t requestId = 0; requestId < subRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
+            RequestExecutor(SoIInferRequestInternal& inferRequest,
+                            HeteroStageGate::Ptr stageGate,
+                            HeteroStageGate::Ptr previousStageGate)
+                : _inferRequest(inferRequest),
+                  _stageGate(std::move(stageGate)),
+                  _previousStageGate(std::move(previousStageGate)) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
                     _exceptionPtr = exceptionPtr;
                     auto capturedTask = std::move(_task);
@@ -26,17 +32,43 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
                 });
             }
             void run(Task task) override {
-                _task = std::move(task);
-                _inferRequest->StartAsync();
+                if (!_stageGate) {
+                    _task = std::move(task);
+                    _inferRequest->StartAsync();
+                    return;
+                }
+                // the task may be started by another request leaving the stage, so the errors are reported
+                // through the pipeline instead of being thrown
+                _stageGate->Enter([this, task] {
+                    if (_previousStageGate)
+                        _previousStageGate->Leave();
+                    _task = task;
+                    try {
+                        _inferRequest->StartAsync();
+                    } catch (...) {
+                        _exceptionPtr = std::current_exception();
+                        auto capturedTask = std::move(_task);
+                        capturedTask();
+                    }
+                });
             };
             SoIInferRequestInternal& _inferRequest;
+            HeteroStageGate::Ptr _stageGate;
+            HeteroStageGate::Ptr _previousStageGate;
             std::exception_ptr _exceptionPtr;
             Task _task;
         };
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
+        auto requestExecutor = std::make_shared<RequestExecutor>(
+            _heteroInferRequest->_inferRequests[requestId]._request,
+            subRequests[requestId]._stageGate,
+            requestId > 0 ? subRequests[requestId - 1]._stageGate : nullptr);
+        const bool lastStage = requestId + 1 == subRequests.size();
+        _pipeline.emplace_back(requestExecutor, [requestExecutor, lastStage] {
+            // the place in the stage is kept until the next stage is started
+            if (requestExecutor->_stageGate && (lastStage || nullptr != requestExecutor->_exceptionPtr)) {
+                requestExecutor->_stageGate->Leave();
+            }
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
             }
@@ -516,6 +516,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitPipelineStages();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -630,6 +631,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
             deviceName,
             loaded ? cnnnetwork : CNNNetwork{},
             executableNetwork,
+            nullptr,
         });
     }
 
@@ -671,6 +673,18 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipelineStages();
+}
+
+void HeteroExecutableNetwork::InitPipelineStages() {
+    auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+    if (itPipeline == _config.end() || itPipeline->second != YES)
+        return;
+    // every stage keeps as many requests in flight as its device can run efficiently
+    for (auto&& network : _networks) {
+        const auto capacity = network._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        network._stageGate = std::make_shared<HeteroStageGate>(capacity);
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -812,6 +826,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._stageGate = subnetwork._stageGate;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
@@ -825,6 +840,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._stageGate = subnetwork._stageGate;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
@@ -846,8 +862,13 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         } else {
             result = std::string{};
         }
-    } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
+    } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(PIPELINE) ||
+               name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
+        if (it == _config.end() && name == HETERO_CONFIG_KEY(PIPELINE)) {
+            // imported from a blob exported before the option was introduced
+            return false;
+        }
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
     } else {
@@ -930,6 +951,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -951,10 +973,14 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // in pipelined mode every subgraph keeps its own requests busy at the same time
+        auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+        const bool pipeline = itPipeline != _config.end() && itPipeline->second == YES;
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            const auto optimal =
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            value = pipeline ? value + optimal : std::max(value, optimal);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else {
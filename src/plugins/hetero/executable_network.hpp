@@ -65,11 +65,13 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitPipelineStages();
 
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal _network;
+        HeteroStageGate::Ptr _stageGate;
     };
 
     std::vector<NetworkDesc> _networks;
@@ -19,6 +19,33 @@ using namespace HeteroPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+void HeteroStageGate::Enter(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_occupied == _capacity) {
+            _waiting.push(std::move(task));
+            return;
+        }
+        ++_occupied;
+    }
+    task();
+}
+
+void HeteroStageGate::Leave() {
+    Task next;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_waiting.empty()) {
+            --_occupied;
+            return;
+        }
+        // the place is handed over to the first waiting request
+        next = std::move(_waiting.front());
+        _waiting.pop();
+    }
+    next();
+}
+
 HeteroInferRequest::HeteroInferRequest(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs,
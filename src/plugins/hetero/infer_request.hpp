@@ -6,17 +6,46 @@
 
 #include <ie_common.h>
 
+#include <algorithm>
+
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
+#include <queue>
 #include <string>
+#include <threading/ie_itask_executor.hpp>
 #include <unordered_map>
 #include <vector>
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Bounds the number of requests in a stage of the pipelined network: a request occupies a place from the start
+ * of the subgraph until it starts the next one, so the finished requests waiting for a slow stage throttle the previous
+ * ones instead of piling up.
+ */
+class HeteroStageGate {
+public:
+    using Ptr = std::shared_ptr<HeteroStageGate>;
+
+    explicit HeteroStageGate(unsigned int capacity) : _capacity(std::max(1u, capacity)) {}
+
+    // Runs the task once the stage has a free place
+    void Enter(InferenceEngine::Task task);
+
+    // Frees the place, possibly running the next waiting task on the calling thread
+    void Leave();
+
+private:
+    std::mutex _mutex;
+    const unsigned int _capacity;
+    unsigned int _occupied = 0;
+    std::queue<InferenceEngine::Task> _waiting;
+};
+
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -25,6 +54,7 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        HeteroStageGate::Ptr _stageGate;  // null if the network is not pipelined
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -25,8 +25,8 @@ using namespace HeteroPlugin;
 
 Engine::Engine() {
     _pluginName = "HETERO";
-    _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE)] = NO;
 }
 
 namespace {
@@ -38,8 +38,24 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
     return config;
 }
 
+// EXCLUSIVE_ASYNC_REQUESTS defaults to YES, but the subgraphs of a pipelined network run concurrently,
+// so there the sub-devices keep their own request queues instead of the single exclusive one
+Engine::Configs applyExclusiveAsyncRequests(Engine::Configs config) {
+    auto itPipeline = config.find(HETERO_CONFIG_KEY(PIPELINE));
+    const bool pipeline = itPipeline != config.end() && itPipeline->second == YES;
+    auto itExclusive = config.find(KEY_EXCLUSIVE_ASYNC_REQUESTS);
+    if (itExclusive == config.end()) {
+        config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = pipeline ? NO : YES;
+    } else if (pipeline && itExclusive->second == YES) {
+        IE_THROW() << HETERO_CONFIG_KEY(PIPELINE) << " can't be used with " << KEY_EXCLUSIVE_ASYNC_REQUESTS
+                   << "=YES, since the subgraphs of a pipelined network run concurrently";
+    }
+    return config;
+}
+
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINE),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -54,7 +70,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(cons
     if (GetCore() == nullptr) {
         IE_THROW() << "Please, work with HETERO device via InferencEngine::Core object";
     }
-    auto tconfig = mergeConfigs(_config, config);
+    auto tconfig = applyExclusiveAsyncRequests(mergeConfigs(_config, config));
     auto it = tconfig.find("TARGET_FALLBACK");
     if (it == tconfig.end()) {
         it = tconfig.find(ov::device::priorities.name());
@@ -69,13 +85,15 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(cons
         IE_THROW() << "HETERO device supports just ngraph network representation";
     }
 
-    return std::make_shared<HeteroExecutableNetwork>(network, mergeConfigs(_config, config), this);
+    return std::make_shared<HeteroExecutableNetwork>(network, tconfig, this);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(
     std::istream& heteroModel,
     const std::map<std::string, std::string>& config) {
-    return std::make_shared<HeteroExecutableNetwork>(heteroModel, mergeConfigs(_config, config), this);
+    return std::make_shared<HeteroExecutableNetwork>(heteroModel,
+                                                     applyExclusiveAsyncRequests(mergeConfigs(_config, config)),
+                                                     this);
 }
 
 Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& targetFallback,
@@ -214,11 +232,11 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
-    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
-        auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(PIPELINE)) {
+        auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
-        bool dump = it->second == YES;
-        return {dump};
+        bool value = it->second == YES;
+        return {value};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -149,6 +149,48 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::YES) {
+                useHugePages = true;
+            } else if (val == PluginConfigParams::NO) {
+                useHugePages = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                    << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_CORE_BUDGET == key) {
+            if (val == PluginConfigParams::YES) {
+                useCoreBudget = true;
+            } else if (val == PluginConfigParams::NO) {
+                useCoreBudget = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_CORE_BUDGET
+                    << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE == key) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Expected only float numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Sparse rate must be in range [0.0f,1.0f]";
+            }
+            fcSparseWeightsDecompressionRate = val_f;
+        } else if (PluginConfigParams::KEY_MODEL_PRIORITY == key) {
+            if (val == PluginConfigParams::MODEL_PRIORITY_HIGH || val == ov::util::to_string(ov::hint::Priority::HIGH)) {
+                coreBudgetWeight = 4;
+            } else if (val == PluginConfigParams::MODEL_PRIORITY_MED || val == ov::util::to_string(ov::hint::Priority::MEDIUM)) {
+                coreBudgetWeight = 2;
+            } else if (val == PluginConfigParams::MODEL_PRIORITY_LOW || val == ov::util::to_string(ov::hint::Priority::LOW)) {
+                coreBudgetWeight = 1;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_MODEL_PRIORITY
+                    << ". Expected only HIGH/MEDIUM/LOW";
+            }
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -178,20 +220,7 @@ void Config::updateProperties() {
     if (!_config.empty())
         return;
 
-    switch (streamExecutorConfig._threadBindingType) {
-    case IStreamsExecutor::ThreadBindingType::NONE:
-        _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::NO });
-        break;
-    case IStreamsExecutor::ThreadBindingType::CORES:
-        _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::YES });
-        break;
-    case IStreamsExecutor::ThreadBindingType::NUMA:
-        _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::NUMA });
-        break;
-    case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
-        _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::HYBRID_AWARE });
-        break;
-    }
+    updateStreamsProperties();
     if (collectPerfCounters == true)
         _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
     else
@@ -207,10 +236,6 @@ void Config::updateProperties() {
 
     _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
 
-    _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
-
-    _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
-
     IE_SUPPRESS_DEPRECATED_START
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
     IE_SUPPRESS_DEPRECATED_END;
@@ -223,6 +248,30 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    _config.insert({ CPUConfigParams::KEY_CPU_CORE_BUDGET, useCoreBudget ? PluginConfigParams::YES : PluginConfigParams::NO });
+    _config.insert({ CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, std::to_string(fcSparseWeightsDecompressionRate) });
+    const auto priority = coreBudgetWeight == 4 ? ov::hint::Priority::HIGH :
+                          coreBudgetWeight == 1 ? ov::hint::Priority::LOW : ov::hint::Priority::MEDIUM;
+    _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, ov::util::to_string(priority) });
+}
+
+void Config::updateStreamsProperties() {
+    switch (streamExecutorConfig._threadBindingType) {
+    case IStreamsExecutor::ThreadBindingType::NONE:
+        _config[PluginConfigParams::KEY_CPU_BIND_THREAD] = PluginConfigParams::NO;
+        break;
+    case IStreamsExecutor::ThreadBindingType::CORES:
+        _config[PluginConfigParams::KEY_CPU_BIND_THREAD] = PluginConfigParams::YES;
+        break;
+    case IStreamsExecutor::ThreadBindingType::NUMA:
+        _config[PluginConfigParams::KEY_CPU_BIND_THREAD] = PluginConfigParams::NUMA;
+        break;
+    case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
+        _config[PluginConfigParams::KEY_CPU_BIND_THREAD] = PluginConfigParams::HYBRID_AWARE;
+        break;
+    }
+    _config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(streamExecutorConfig._streams);
+    _config[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(streamExecutorConfig._threads);
 }
 
 #ifdef CPU_DEBUG_CAPS
@@ -34,6 +34,12 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    bool useHugePages = false;
+    bool useCoreBudget = false;
+    // relative share of the core budget, derived from the model priority, which has no effect without the core budget
+    unsigned coreBudgetWeight = 2;
+    // minimal share of zero values in the FullyConnected weights to use sparse weights, 1 disables them
+    float fcSparseWeightsDecompressionRate = 1.0f;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -52,6 +58,8 @@ struct Config {
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
+    // refreshes only the streams related keys, e.g. after the core budget has granted fewer cores
+    void updateStreamsProperties();
     std::map<std::string, std::string> _config;
 
 #ifdef CPU_DEBUG_CAPS
@@ -5,6 +5,15 @@
 #include <vector>
 #include <numeric>
 #include <unordered_set>
+#include <atomic>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <fstream>
+#endif
 
 #include <dnnl_types.h>
 #include <common/memory_desc_wrapper.hpp>
@@ -16,6 +25,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -31,8 +41,152 @@ namespace {
             }
         }
     }
+
+    thread_local int currentNumaNodeId = -1;
+    std::atomic<size_t> numaBoundBytes{0};
+    std::atomic<size_t> numaCrossNodeBytes{0};
+
+    thread_local bool hugePagesEnabled = false;
+    std::atomic<size_t> hugePageBytes{0};
+    std::atomic<size_t> hugePagesFallbackBytes{0};
+
+    size_t getPageSize() {
+#if defined(__linux__)
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return pageSize;
+#else
+        return 4096;
+#endif
+    }
+
+    size_t getHugePageSize() {
+        static const size_t hugePageSize = [] {
+            size_t size = 2 * 1024 * 1024;
+#if defined(__linux__)
+            std::ifstream sysfs("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+            size_t sysfsSize = 0;
+            if (sysfs >> sysfsSize && sysfsSize > 0)
+                size = sysfsSize;
+#endif
+            return size;
+        }();
+        return hugePageSize;
+    }
+
+    bool adviseHugePages(void* ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        return madvise(ptr, size, MADV_HUGEPAGE) == 0;
+#else
+        return false;
+#endif
+    }
+
+    // The syscalls are used directly to avoid the dependency on libnuma
+    bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+        constexpr int mpolPreferred = 1;        // MPOL_PREFERRED: falls back to the other nodes if the node is out of memory
+        constexpr unsigned mpolMfMove = 1 << 1;  // MPOL_MF_MOVE: migrate the pages which are already faulted in
+        unsigned long nodeMask = 0;
+        const unsigned long maxNode = sizeof(nodeMask) * 8;
+        if (numaNodeId < 0 || static_cast<unsigned long>(numaNodeId) >= maxNode - 1)
+            return false;
+        nodeMask = 1ul << numaNodeId;
+        return syscall(SYS_mbind, ptr, size, mpolPreferred, &nodeMask, maxNode, mpolMfMove) == 0;
+#else
+        return false;
+#endif
+    }
+
+    int getPageNumaNode(void* ptr) {
+#if defined(__linux__) && defined(SYS_move_pages)
+        void* pages[] = {ptr};
+        int status = -1;
+        // nodes == nullptr means that the pages are not moved, only their current nodes are returned
+        if (syscall(SYS_move_pages, 0, 1, pages, nullptr, &status, 0) == 0)
+            return status;
+#endif
+        return -1;
+    }
 }   // namespace
 
+NumaAllocationScope::NumaAllocationScope(int numaNodeId) : prevNumaNodeId(currentNumaNodeId) {
+    if (numaNodeId >= 0)
+        currentNumaNodeId = numaNodeId;
+}
+
+NumaAllocationScope::~NumaAllocationScope() {
+    currentNumaNodeId = prevNumaNodeId;
+}
+
+int NumaAllocationScope::getCurrentNumaNodeId() {
+    return currentNumaNodeId;
+}
+
+NumaAllocationScope::Statistics NumaAllocationScope::getStatistics() {
+    Statistics statistics;
+    statistics.boundBytes = numaBoundBytes.load(std::memory_order_relaxed);
+    statistics.crossNodeBytes = numaCrossNodeBytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void* NumaAllocationScope::allocate(size_t size, int alignment) {
+    const int numaNodeId = currentNumaNodeId;
+    const size_t pageSize = getPageSize();
+    const bool useHugePages = hugePagesEnabled && size >= getHugePageSize();
+    // small buffers share pages with other allocations, so they are left to the first-touch policy
+    if (!useHugePages && (numaNodeId < 0 || size < pageSize))
+        return dnnl::impl::malloc(size, alignment);
+
+    // huge pages are used only for the aligned regions
+    const size_t pageAlignment = useHugePages ? getHugePageSize() : pageSize;
+    // The buffer is allocated as whole pages, so the binding and the first touch below never affect
+    // the neighbouring heap objects that would share its first or last page otherwise
+    size = rnd_up(size, pageSize);
+    void *ptr = dnnl::impl::malloc(size, static_cast<int>(std::max(static_cast<size_t>(alignment), pageAlignment)));
+    if (!ptr)
+        return ptr;
+
+    // madvise must precede the first touch, otherwise the regular pages are already faulted in
+    if (useHugePages) {
+        if (adviseHugePages(ptr, size))
+            hugePageBytes.fetch_add(size, std::memory_order_relaxed);
+        else
+            hugePagesFallbackBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    if (numaNodeId < 0 || !bindToNumaNode(ptr, size, numaNodeId))
+        return ptr;
+
+    auto bytes = static_cast<volatile char*>(ptr);
+    for (size_t offset = 0; offset < size; offset += pageSize)
+        bytes[offset] = 0;
+
+    numaBoundBytes.fetch_add(size, std::memory_order_relaxed);
+    const int actualNumaNodeId = getPageNumaNode(ptr);
+    if (actualNumaNodeId >= 0 && actualNumaNodeId != numaNodeId)
+        numaCrossNodeBytes.fetch_add(size, std::memory_order_relaxed);
+    return ptr;
+}
+
+HugePagesScope::HugePagesScope(bool enable) : prevEnabled(hugePagesEnabled) {
+    hugePagesEnabled = enable || prevEnabled;
+}
+
+HugePagesScope::~HugePagesScope() {
+    hugePagesEnabled = prevEnabled;
+}
+
+bool HugePagesScope::isEnabled() {
+    return hugePagesEnabled;
+}
+
+HugePagesScope::Statistics HugePagesScope::getStatistics() {
+    Statistics statistics;
+    statistics.hugePageBytes = hugePageBytes.load(std::memory_order_relaxed);
+    statistics.fallbackBytes = hugePagesFallbackBytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 Memory::Memory(const dnnl::engine& eng) :
     eng(eng), mgrHandle(std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())), this) {}
 Memory::Memory(const dnnl::engine& eng, std::unique_ptr<IMemoryMngr> mngr) :
@@ -183,7 +337,7 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        void *ptr = NumaAllocationScope::allocate(size, cacheLineSize);
         if (!ptr) {
             throw std::bad_alloc();
         }
@@ -69,6 +69,67 @@ public:
     virtual bool hasExtBuffer() const noexcept = 0;
 };
 
+/**
+ * @brief Places the buffers allocated by the memory managers on the current thread to the given NUMA node.
+ * The graph sets the scope for its creation and inference, so the weights and the per-stream buffers
+ * are bound to the NUMA node of the stream that uses them. The pages are touched on the allocating
+ * (stream) thread right after the binding, so they are not faulted in later by some other thread.
+ * Negative NUMA node id keeps the NUMA node of the enclosing scope (e.g. for the nested graphs),
+ * there is no binding outside of the scopes.
+ */
+class NumaAllocationScope {
+public:
+    struct Statistics {
+        size_t boundBytes = 0;
+        size_t crossNodeBytes = 0;  // bytes which are bound, but reside on the other NUMA node (e.g. the node is out of memory)
+    };
+
+    explicit NumaAllocationScope(int numaNodeId);
+    ~NumaAllocationScope();
+
+    NumaAllocationScope(const NumaAllocationScope&) = delete;
+    NumaAllocationScope& operator= (const NumaAllocationScope&) = delete;
+
+    static int getCurrentNumaNodeId();
+    static Statistics getStatistics();
+
+    /**
+     * @brief Allocates a buffer, binds it to the current NUMA node and touches its pages.
+     * The buffers of at least one huge page are backed by huge pages if they are enabled by HugePagesScope
+     * @return pointer to the buffer which must be released by dnnl::impl::free
+     */
+    static void* allocate(size_t size, int alignment);
+
+private:
+    int prevNumaNodeId;
+};
+
+/**
+ * @brief Backs the buffers allocated by the memory managers on the current thread with transparent huge pages.
+ * Only the buffers of at least one huge page are affected (the weights and the graph workspace in practice),
+ * if the kernel doesn't support THP the regular pages are used.
+ * The scope can only enable huge pages, disabled scope keeps the setting of the enclosing one.
+ */
+class HugePagesScope {
+public:
+    struct Statistics {
+        size_t hugePageBytes = 0;
+        size_t fallbackBytes = 0;  // bytes which were requested to be backed by huge pages, but madvise failed
+    };
+
+    explicit HugePagesScope(bool enable);
+    ~HugePagesScope();
+
+    HugePagesScope(const HugePagesScope&) = delete;
+    HugePagesScope& operator= (const HugePagesScope&) = delete;
+
+    static bool isEnabled();
+    static Statistics getStatistics();
+
+private:
+    bool prevEnabled;
+};
+
 /**
  * @brief An implementation of the mem manager where memory reallocation occures only if bigger buffer is requested.
  */
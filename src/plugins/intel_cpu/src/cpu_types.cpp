@@ -197,6 +197,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Subgraph", Type::Subgraph},
         { "PriorBox", Type::PriorBox},
         { "PriorBoxClustered", Type::PriorBoxClustered},
+        { "ImagePreprocess", Type::ImagePreprocess},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -292,6 +293,8 @@ std::string NameFromType(const Type type) {
             return "Convert";
         case Type::ColorConvert:
             return "ColorConvert";
+        case Type::ImagePreprocess:
+            return "ImagePreprocess";
         case Type::NormalizeL2:
             return "NormalizeL2";
         case Type::ScatterUpdate:
@@ -6,8 +6,10 @@
 
 #include <ngraph/rt_info.hpp>
 #include <ngraph/variant.hpp>
+#include <ie_ngraph_utils.hpp>
 
 #include "jit_emitter.hpp"
+#include "jit_load_store_emitters.hpp"
 
 using namespace Xbyak;
 
@@ -18,16 +20,18 @@ namespace intel_cpu {
 #define SNIPPETS_MAX_HARNESS_DIMS 5
 #define SNIPPETS_MAX_TILE_RANK 2
 #define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+// Work amounts and pointer increments are passed at runtime, so the same kernel can be reused
+// for all the shapes that share rank, layout and broadcasting pattern (including dynamic ones)
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t scheduler_work_amounts[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
-    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
-    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
-    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
-    std::vector<size_t> output_dims = {};
+    size_t harness_num_dims = 0;
 };
 ///
 /// \brief    Kernel is the only entry point to Codogen Jit compilation. Kernel calculates appropriate data offsets,
@@ -43,17 +47,19 @@ struct jit_snippets_compile_args {
 ///         }
 ///     }
 /// }
-/// Note that Kernel params are passed directly to the emit_code(). The vector of inputs should contain 2 arguments, the
+/// Note that Kernel params are passed directly to the emit_code(). The vector of inputs should contain 3 arguments, the
 /// output vector should be empty. Input parameters
 ///
 /// \param      in[0]       The number of the node inputs
 /// \param      in[1]      The number of the node outputs
+/// \param      in[2]      The number of vector stack slots used by Spill and Fill emitters
+///
+/// The stack slots are addressed relative to RBP, since tiles move the stack pointer.
+///
+/// Data offsets are read from jit_snippets_call_args at runtime, so the kernel doesn't depend on the actual dims.
 ///
-// Todo: Scheduler dims and offsets are currently calculated in Subgraph node and passed to the KernelEmitter.
-//  However, it seems more natural to calculate all the offsets right in the Kernel op, because the calculation is
-//  not device-specific. It is based only on input/output dims (which we already know) and harness num dims
-//  (which we should pass from the plugin). It seems also better to wrap the enclosed emitters in tiles in the Kernel op
-//  and avoid creating empty tiles.
+// Todo: Scheduler dims and offsets are currently calculated in Subgraph node and passed to the kernel in call args.
+//  It seems also better to wrap the enclosed emitters in tiles in the Kernel op and avoid creating empty tiles.
 class KernelEmitter : public jit_emitter {
 public:
     KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
@@ -79,15 +85,15 @@ public:
 private:
     void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
                             const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
-        if (in.size() != 2)
-            IE_THROW() << "KernelEmitter got invalid number of inputs. Expected 2, got " << in.size();
+        if (in.size() != 3)
+            IE_THROW() << "KernelEmitter got invalid number of inputs. Expected 3, got " << in.size();
         if (out.size() != 0)
             IE_THROW() << "KernelEmitter got unexpected output arguments.";
         const size_t num_params = in[0] + in[1];
         if (num_params > SNIPPETS_MAX_SNIPPETS_DIMS)
             IE_THROW() << "KernelEmitter supports only up to " << SNIPPETS_MAX_SNIPPETS_DIMS <<
                        " parameters, got " << num_params;
-        const int64_t harness_num_dims = jcp.output_dims.size() - 1;
+        const size_t harness_num_dims = jcp.harness_num_dims;
         if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS)
             IE_THROW() << "KernelEmitter supports harness with up to " << SNIPPETS_MAX_HARNESS_DIMS <<
                        " dims, got " << harness_num_dims;
@@ -101,23 +107,27 @@ private:
         const size_t num_inputs = in[0];
         const size_t num_outputs = in[1];
         const size_t num_params = num_inputs + num_outputs;
+        const size_t spill_size = in[2] * get_vec_length();
         int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
-        const int64_t harness_num_dims = jcp.output_dims.size() - 1;
+        const size_t harness_num_dims = jcp.harness_num_dims;
 
         Reg64 reg_indexes   { dnnl::impl::cpu::x64::abi_param_regs[0] };
         Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param_regs[1] };
         Xbyak::Reg64 reg_tmp_64 { dnnl::impl::cpu::x64::abi_not_param_reg };
 
         h->preamble();
+        if (spill_size > 0) {
+            h->sub(h->rsp, spill_size);
+            h->mov(h->rbp, h->rsp);
+        }
 
         std::vector<Reg64> regs(num_params);
-        auto init_ptrs_with_offsets = [&](Reg64 pointer, const int64_t *offsets) {
-            for (int j = 0; j < harness_num_dims; j++) {
-                if (jcp.output_dims[j] != 1 && offsets[j] != 0) {
-                    h->mov(reg_tmp_64, offsets[j]);
-                    h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
-                    h->add(pointer, reg_tmp_64);
-                }
+        // pointer += sum(data_offsets[j] * indexes[j]), offsets are zero for the broadcasted dims
+        auto init_ptrs_with_offsets = [&](Reg64 pointer, size_t offsets_idx) {
+            for (size_t j = 0; j < harness_num_dims; j++) {
+                h->mov(reg_tmp_64, h->ptr[reg_const_params + GET_OFF(data_offsets) + (offsets_idx + j) * sizeof(int64_t)]);
+                h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp_64);
             }
         };
         for (auto i = 0; i < num_params; i++) {
@@ -126,13 +136,15 @@ private:
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
             else
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-            init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
+            init_ptrs_with_offsets(regs[i], i * harness_num_dims);
         }
 
         for (auto& c : code) {
             c.first->emit_code(c.second.first, c.second.second, pool, gpr);
         }
 
+        if (spill_size > 0)
+            h->add(h->rsp, spill_size);
         h->postamble();
     }
 
@@ -144,6 +156,9 @@ private:
 /// it calculates the total number of iterations, performs operations specified by enclosed emitters, advances iteration counters
 /// and breaks when necessary.
 ///
+/// The work amount is read from jit_snippets_call_args by the first tile in a dimension, the following (tail) tiles
+/// process whatever is left.
+///
 /// \param      in[0]    The number of input entities (or scheduler counts) processed during one iteration of the tile.
 /// It is expected to be 1 for outer or scalar tiles and vlen for vector tiles.
 /// \param      in[1]    Increment of the previous Tile in current dimension. Must be 0 if this is the first Tile.
@@ -163,10 +178,7 @@ public:
         const auto tile = ov::as_type_ptr<ngraph::snippets::op::Tile>(n);
         if (!tile)
             IE_THROW() << "TileEmitter invoked with invalid op argument";
-        if (!tile->compile_params)
-            IE_THROW() << "TileEmitter invoked without compile_params";
         code = tile->region;
-        jcp = *reinterpret_cast<const jit_snippets_compile_args*>(tile->compile_params);
     }
 
     size_t get_inputs_num() const override {return 0;}
@@ -205,6 +217,7 @@ private:
         const size_t dim = in[3]; // tile dimension: 0 - outer, 1 - inner
         const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
         Reg64 amount = Reg64(reg64_tmp_start + num_params); // amount
+        Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param_regs[1] };
         std::array<Label, 2> for_body;
 
         // If R15 is not used, reserve it for use in scalar to avoid redundant push-pop's.
@@ -213,46 +226,31 @@ private:
         std::vector<Reg64> regs(num_params);
         for (auto i = 0; dim == 0 && i < num_params; i++)
             regs[i] = Reg64(reg64_tmp_start + i);
-        // Loop processing could be simplified in some cases
-        if (inc > jcp.scheduler_dims[dim]) {
-            return;
-        } else if (inc == jcp.scheduler_dims[dim]) {
+        // The previous tile has done nothing, all the work is ours.
+        // Otherwise the previous tile has already left the remaining work amount in the register.
+        if (previous_inc == 0)
+            h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_work_amounts) + dim * sizeof(int64_t)]);
+        h->cmp(amount, inc);
+        h->jl(for_body[0], CodeGenerator::T_NEAR);
+
+        h->L(for_body[1]);
+        {
+            h->push(amount);
             for (auto& c : code) {
                 c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
             }
-        } else {
-            // The previous tile has done nothing, all the work is ours
-            if (previous_inc == 0 || previous_inc > jcp.scheduler_dims[dim]) {
-                h->mov(amount, jcp.scheduler_dims[dim]);
-            // The previous tile has done all the work
-            } else if (jcp.scheduler_dims[dim] % previous_inc == 0) {
-                return;
-            }// else: the previous tile has already set a proper work amount
+            h->pop(amount);
+            // Todo: Load and Store emitters are currently implemented so they ALWAYS increment appropriate pointers
+            //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
+            //   To overcome this limitation, we add appropriate negative offsets (zero if not necessary).
+            for (auto i = 0; dim == 0 && i < num_params; i++)
+                h->add(regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+            h->sub(amount, inc);
             h->cmp(amount, inc);
-            h->jl(for_body[0], CodeGenerator::T_NEAR);
-
-            h->L(for_body[1]);
-            {
-                h->push(amount);
-                for (auto& c : code) {
-                    c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
-                }
-                h->pop(amount);
-                // Todo: Load and Store emitters are currently implemented so they ALWAYS increment appropriate pointers
-                //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
-                //   To overcome this limitation, we add appropriate negative offsets if necessary.
-                for (auto i = 0; dim == 0 && i < num_params; i++) {
-                    if (jcp.scheduler_offsets[i] != 0) {
-                        h->add(regs[i], jcp.scheduler_offsets[i]);
-                    }
-                }
-                    h->sub(amount, inc);
-                    h->cmp(amount, inc);
-                    h->jge(for_body[1], CodeGenerator::T_NEAR);
-            }
-
-            h->L(for_body[0]);
+            h->jge(for_body[1], CodeGenerator::T_NEAR);
         }
+
+        h->L(for_body[0]);
     }
 
     // A = <42, 17>
@@ -290,7 +288,70 @@ private:
     //   ptr0 -= 0*dom_1*dom2;
     //   ptr1 -= 1*dom_1*dom2;
     // }
-    jit_snippets_compile_args jcp;
+    std::vector<std::pair<std::shared_ptr<Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+///
+/// \brief    ReductionTile wraps a complete pass over the innermost dimension, which computes a horizontal reduction:
+/// ReductionTileEmitter {
+///     ScalarEmitter            /* accumulator initialization */
+///     TileEmitter { ... }      /* vector tile, accumulates into the reduction register */
+///     HorizonEmitter           /* reduces accumulator lanes */
+///     TileEmitter { ... }      /* scalar tile, accumulates into the first lane */
+///     FakeBroadcastEmitter     /* broadcasts the first lane */
+/// }
+/// Load/Store emitters increment data pointers, so the pointers are saved before the pass and restored after it
+/// to read the same data again in the following passes.
+///
+/// \param      in[0]    sum number inputs and number of outputs of the node.
+///
+class ReductionTileEmitter : public jit_emitter {
+public:
+    ReductionTileEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
+    const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto tile = ov::as_type_ptr<ngraph::snippets::op::ReductionTile>(n);
+        if (!tile)
+            IE_THROW() << "ReductionTileEmitter invoked with invalid op argument";
+        code = tile->region;
+    }
+
+    size_t get_inputs_num() const override {return 0;}
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+              const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
+        validate_arguments(in, out, pool, gpr);
+        emit_impl(in, out, pool, gpr, nullptr);
+    }
+
+private:
+    void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                            const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
+        if (in.size() != 1)
+            IE_THROW() << "ReductionTileEmitter got invalid number of inputs. Expected 1, got " << in.size();
+        if (out.size() != 0)
+            IE_THROW() << "ReductionTileEmitter got unexpected output arguments.";
+        if (in[0] > SNIPPETS_MAX_SNIPPETS_DIMS)
+            IE_THROW() << "ReductionTileEmitter supports only up to " << SNIPPETS_MAX_SNIPPETS_DIMS <<
+                       " parameters, got " << in[0];
+    }
+
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const ov::intel_cpu::emitter_context *emit_context) const override {
+        const size_t num_params = in[0];
+        const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
+        for (size_t i = 0; i < num_params; i++)
+            h->push(Reg64(reg64_tmp_start + i));
+        for (auto& c : code) {
+            c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+        }
+        for (size_t i = num_params; i > 0; i--)
+            h->pop(Reg64(reg64_tmp_start + i - 1));
+    }
+
     std::vector<std::pair<std::shared_ptr<Emitter>, ngraph::snippets::RegInfo>> code;
 };
 
@@ -360,6 +421,78 @@ private:
     bool use_broadcast;
 };
 
+/// HorizonEmitter reduces all the lanes of a vector register with max or sum and broadcasts the result to all the lanes.
+class HorizonEmitter : public jit_emitter {
+public:
+    HorizonEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        if (ov::is_type<ngraph::snippets::op::HorizonMax>(n))
+            is_max = true;
+        else if (ov::is_type<ngraph::snippets::op::HorizonSum>(n))
+            is_max = false;
+        else
+            IE_THROW() << "HorizonEmitter invoked with invalid op argument";
+    }
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src = Vmm(in[0]);
+        Vmm vmm_dst = Vmm(out[0]);
+        Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+
+        auto reduce = [&]() {
+            if (is_max)
+                h->uni_vmaxps(vmm_dst, vmm_dst, vmm_aux);
+            else
+                h->uni_vaddps(vmm_dst, vmm_dst, vmm_aux);
+        };
+
+        if (vmm_dst.getIdx() != vmm_src.getIdx())
+            h->uni_vmovups(vmm_dst, vmm_src);
+        // every step combines the register with its permutation, so all the lanes hold the result in the end
+        if (isa == dnnl::impl::cpu::x64::avx512_core) {
+            h->vshuff32x4(Zmm(vmm_aux.getIdx()), Zmm(vmm_dst.getIdx()), Zmm(vmm_dst.getIdx()), 0x4E);
+            reduce();
+            h->vshuff32x4(Zmm(vmm_aux.getIdx()), Zmm(vmm_dst.getIdx()), Zmm(vmm_dst.getIdx()), 0xB1);
+            reduce();
+        } else if (isa == dnnl::impl::cpu::x64::avx2) {
+            h->vperm2f128(Ymm(vmm_aux.getIdx()), Ymm(vmm_dst.getIdx()), Ymm(vmm_dst.getIdx()), 0x01);
+            reduce();
+        }
+        h->uni_vshufps(vmm_aux, vmm_dst, vmm_dst, 0x4E);
+        reduce();
+        h->uni_vshufps(vmm_aux, vmm_dst, vmm_dst, 0xB1);
+        reduce();
+    }
+
+private:
+    bool is_max;
+};
+
 class ScalarEmitter : public jit_emitter {
 public:
     ScalarEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
@@ -404,6 +537,92 @@ private:
     int32_t value;
 };
 
+///
+/// \brief    Spill and Fill move the values which don't fit into the register file to the stack slots of the kernel and back.
+/// The slots are reserved by KernelEmitter and addressed relative to RBP.
+///
+class SpillEmitter : public jit_emitter {
+public:
+    SpillEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto spill = ov::as_type_ptr<ngraph::snippets::op::Spill>(n);
+        if (!spill)
+            IE_THROW() << "SpillEmitter invoked with invalid op argument";
+        slot = spill->get_slot();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        h->uni_vmovups(h->ptr[h->rbp + slot * dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen], Vmm(in[0]));
+    }
+
+private:
+    size_t slot;
+};
+
+class FillEmitter : public jit_emitter {
+public:
+    FillEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto fill = ov::as_type_ptr<ngraph::snippets::op::Fill>(n);
+        if (!fill)
+            IE_THROW() << "FillEmitter invoked with invalid op argument";
+        slot = fill->get_slot();
+    }
+
+    size_t get_inputs_num() const override {return 0;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        h->uni_vmovups(Vmm(out[0]), h->ptr[h->rbp + slot * dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen]);
+    }
+
+private:
+    size_t slot;
+};
+
 ///
 /// Memory emitters:
 ///
@@ -413,15 +632,39 @@ private:
 /// If Load goes before BroadcastLoad topologicaly the resilt will be incorrect
 /// For scalar loads we can use different tiles. Tiling indeed can be arbitrary and post increment should be somehow coded into ISA.
 /// Blocked parameter to tell if input is actually blocked. Broadcast means broadcast by W in other cases no need to substitute load.
+/// If the input and output precisions differ, the conversion is delegated to jit_load_emitter/jit_store_emitter,
+/// the computations are always performed in FP32. Low precision is stored as BF16 only.
 class MemoryEmitter : public jit_emitter  {
 public:
     MemoryEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : jit_emitter(h, isa, n), ea(getEA(n)) {
+    : jit_emitter(h, isa, n), ea(getEA(n)),
+      src_prc(InferenceEngine::details::convertPrecision(n->get_input_element_type(0))),
+      dst_prc(InferenceEngine::details::convertPrecision(n->get_output_element_type(0))) {
     }
 
     size_t get_inputs_num() const override {return 1;}
 
+    void emit_data() const override {
+        jit_emitter::emit_data();
+        if (load_emitter)
+            load_emitter->emit_data();
+        if (store_emitter)
+            store_emitter->emit_data();
+    }
+
 protected:
+    // count is a number of elements processed by the instruction: lanes for vector tiles and 1 for scalar ones
+    void create_convert_emitters(int count) {
+        if (src_prc == dst_prc)
+            return;
+        if (dst_prc == InferenceEngine::Precision::FP32)
+            load_emitter.reset(new jit_load_emitter(h, host_isa_, src_prc, dst_prc, count));
+        else if (src_prc == InferenceEngine::Precision::FP32 && dst_prc == InferenceEngine::Precision::BF16)
+            store_emitter.reset(new jit_store_emitter(h, host_isa_, src_prc, dst_prc, count));
+        else
+            IE_THROW() << "Snippets memory emitter doesn't support conversion from " << src_prc << " to " << dst_prc;
+    }
+
     static auto getEA(const std::shared_ptr<ov::Node>& n) -> size_t {
         auto& rt = n->get_rt_info();
         size_t ea = 0;
@@ -435,12 +678,17 @@ protected:
     }
 
     size_t ea;
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
 };
 
 class StoreEmitter : public MemoryEmitter  {
 public:
     StoreEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n) {
+        create_convert_emitters(static_cast<int>(get_vec_length() / sizeof(float)));
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -468,6 +716,11 @@ private:
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                     Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
+        if (store_emitter) {
+            store_emitter->emit_code({in[0]}, {ea});
+            h->add(out_reg, dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float) * dst_prc.size());
+            return;
+        }
         Vmm vmm_src0 = Vmm(in[0]);
         h->uni_vmovups(h->ptr[out_reg], vmm_src0);
         h->add(out_reg, dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
@@ -478,6 +731,7 @@ class ScalarStoreEmitter : public MemoryEmitter {
 public:
     ScalarStoreEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n) {
+        create_convert_emitters(1);
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -505,6 +759,11 @@ private:
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                         Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
+        if (store_emitter) {
+            store_emitter->emit_code({in[0]}, {ea});
+            h->add(out_reg, dst_prc.size());
+            return;
+        }
         Xmm vmm_src0 = Xmm(in[0]);
         h->uni_vmovss(h->ptr[out_reg], vmm_src0);
         h->add(out_reg, sizeof(float));
@@ -515,6 +774,7 @@ class LoadEmitter : public MemoryEmitter {
 public:
     LoadEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+        create_convert_emitters(static_cast<int>(get_vec_length() / sizeof(float)));
     }
 
     size_t get_inputs_num() const override {return 0;}
@@ -543,10 +803,13 @@ private:
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Vmm vmm_src0 = Vmm(out[0]);
-        h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter)
+            load_emitter->emit_code({ea}, {out[0]});
+        else
+            h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
 
         if (shouldPostIncrement) {
-            h->add(in_reg, dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+            h->add(in_reg, dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float) * src_prc.size());
         }
     }
 
@@ -558,6 +821,7 @@ class BroadcastLoadEmitter : public MemoryEmitter {
 public:
     BroadcastLoadEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n) {
+        create_convert_emitters(1);
     }
     size_t get_inputs_num() const override {return 0;}
 
@@ -588,7 +852,13 @@ private:
 
         // In doesn't really matter if we broadcast or `movss` for vector tails so keep only one version for `BroadcastLoad`,
         // key point here is not to add post-increment, it might be fixed by some other approach in future
-        h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter) {
+            // the converted value is placed in the lowest lane
+            load_emitter->emit_code({ea}, {out[0]});
+            h->uni_vbroadcastss(vmm_src0, Xmm(out[0]));
+        } else {
+            h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        }
     }
 };
 
@@ -596,6 +866,7 @@ class ScalarLoadEmitter : public MemoryEmitter {
 public:
     ScalarLoadEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+        create_convert_emitters(1);
     }
     size_t get_inputs_num() const override {return 0;}
 
@@ -623,11 +894,14 @@ private:
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Xmm vmm_src0 = Xmm(out[0]);
-        h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter)
+            load_emitter->emit_code({ea}, {out[0]});
+        else
+            h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
 
         // Doesn't work if the same pointer comes with multiple load operations
         if (shouldPostIncrement) {
-            h->add(in_reg, sizeof(float));
+            h->add(in_reg, src_prc.size());
         }
     }
 
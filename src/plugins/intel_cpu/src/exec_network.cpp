@@ -26,6 +26,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -102,7 +103,18 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (_cfg.useCoreBudget) {
+            // the budget may grant fewer cores than requested, so the graphs are created for the granted streams
+            _taskExecutor = _plugin->executorManager()->getBudgetedCPUStreamsExecutor(streamsExecutorConfig,
+                                                                                      _cfg.coreBudgetWeight);
+            _cfg.streamExecutorConfig._streams = streamsExecutorConfig._streams;
+            _cfg.streamExecutorConfig._threadsPerStream = streamsExecutorConfig._threadsPerStream;
+            _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
+            _cfg.streamExecutorConfig._threadBindingType = streamsExecutorConfig._threadBindingType;
+            _cfg.updateStreamsProperties();
+        } else {
+            _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
 #endif
     }
     if (0 != cfg.streamExecutorConfig._streams) {
@@ -179,7 +191,15 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                // binding makes sense only if the stream is pinned to a NUMA node of a multi-socket host
+                if (nullptr != streamsExecutor && InferenceEngine::getAvailableNUMANodes().size() > 1)
+                    graphLock._graph.setNumaNodeId(numaNodeId);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                DEBUG_LOG("Graph for stream ", streamId, " is created on NUMA node ", numaNodeId,
+                          ": NUMA bound bytes ", NumaAllocationScope::getStatistics().boundBytes,
+                          ", cross-node bytes ", NumaAllocationScope::getStatistics().crossNodeBytes,
+                          ", huge page bytes ", HugePagesScope::getStatistics().hugePageBytes,
+                          ", huge page fallback bytes ", HugePagesScope::getStatistics().fallbackBytes);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -310,6 +330,7 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::reserved_cores.name()),
         };
     }
 
@@ -352,6 +373,14 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::reserved_cores) {
+        // the cores are rebalanced when other models join or leave the budget, so the current ones are reported
+        decltype(ov::intel_cpu::reserved_cores)::value_type reservedCores;
+        if (auto budgeted = std::dynamic_pointer_cast<InferenceEngine::IBudgetedStreamsExecutor>(_taskExecutor)) {
+            for (auto core : budgeted->getReservedCores())
+                reservedCores.push_back(static_cast<size_t>(core));
+        }
+        return reservedCores;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -25,6 +25,7 @@
 #include "nodes/input.h"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
+#include "nodes/fullyconnected.h"
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -70,6 +71,8 @@ template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
         WeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
+    NumaAllocationScope numaScope(numaNodeId);
+    HugePagesScope hugePagesScope(config.useHugePages);
 
     if (IsReady())
         ForgetGraphData();
@@ -154,6 +157,8 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const Ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        if (node->getType() == Type::FullyConnected)
+            std::static_pointer_cast<node::FullyConnected>(node)->setSparseWeightsDecompressionRate(config.fcSparseWeightsDecompressionRate);
 
         graphNodes.push_back(node);
 
@@ -266,6 +271,8 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        if (node->getType() == Type::FullyConnected)
+            std::static_pointer_cast<node::FullyConnected>(node)->setSparseWeightsDecompressionRate(config.fcSparseWeightsDecompressionRate);
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -408,6 +415,8 @@ void Graph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+
+    CompileExecutionPlan();
 }
 
 void Graph::InitNodes() {
@@ -475,6 +484,35 @@ void Graph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+/**
+ * The memory and the primitive arguments of the static nodes are bound by Allocate() and CreatePrimitives(),
+ * so Infer() may run such graph as a flat sequence of the pre-bound execute() calls, without the per node
+ * dynamism and diagnostics checks. The graphs with dynamic nodes, the performance counters or the debug
+ * capabilities (verbose, node dumps) use the generic loop.
+ */
+void Graph::CompileExecutionPlan() {
+    executionPlan.clear();
+#ifndef CPU_DEBUG_CAPS
+    if (config.collectPerfCounters)
+        return;
+    if (std::any_of(executableGraphNodes.begin(), executableGraphNodes.end(),
+                    [](const NodePtr& node) { return node->isDynamicNode(); }))
+        return;
+
+    inferStream = dnnl::stream(eng);
+    executionPlan.reserve(executableGraphNodes.size());
+    for (const auto& node : executableGraphNodes) {
+        // the graph owns the nodes for the lifetime of the plan
+        Node* execNode = node.get();
+        const dnnl::stream stream = inferStream;
+        executionPlan.emplace_back([execNode, stream]() {
+            OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, execNode->perfCounters().execute);
+            execNode->execute(stream);
+        });
+    }
+#endif
+}
+
 void Graph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
     dnnl::stream stream(eng);
@@ -1000,8 +1038,23 @@ void Graph::Infer(InferRequestBase* request) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
+    // dynamic shapes may cause reallocations
+    NumaAllocationScope numaScope(numaNodeId);
+    HugePagesScope hugePagesScope(config.useHugePages);
 
-    dnnl::stream stream(eng);
+    if (!executionPlan.empty()) {
+        // checked once for the whole plan, InferRequestBase checks the cancellation again after Infer()
+        if (request)
+            request->ThrowIfCanceled();
+        for (const auto& step : executionPlan) {
+            step();
+        }
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
+    if (!inferStream)
+        inferStream = dnnl::stream(eng);
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
@@ -1009,7 +1062,7 @@ void Graph::Infer(InferRequestBase* request) {
 
         if (request)
             request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+        ExecuteNode(node, inferStream);
     }
 
     if (infer_count != -1) infer_count++;
@@ -16,6 +16,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 namespace ov {
 namespace intel_cpu {
@@ -47,6 +48,11 @@ public:
     void setConfig(const Config &cfg);
     const Config& getConfig() const;
 
+    // Graph buffers are bound to the given NUMA node on creation and inference, see NumaAllocationScope
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
@@ -202,6 +208,8 @@ protected:
     void ForgetGraphData() {
         status = NotReady;
         eng = dnnl::engine(dnnl::engine::kind::cpu, 0);
+        inferStream = dnnl::stream();
+        executionPlan.clear();
 
         inputNodesMap.clear();
         outputNodesMap.clear();
@@ -218,6 +226,8 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    int numaNodeId = -1;
+
     MemoryPtr memWorkspace;
 
     std::vector<NodePtr> graphNodes;
@@ -242,6 +252,7 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void CompileExecutionPlan();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
 
@@ -260,6 +271,10 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
+    // created on the first Infer() call and reused by the subsequent ones
+    dnnl::stream inferStream;
+    // the executable nodes of the static graph bound to inferStream, see CompileExecutionPlan()
+    std::vector<std::function<void()>> executionPlan;
 
     MultiCachePtr rtParamsCache;
 
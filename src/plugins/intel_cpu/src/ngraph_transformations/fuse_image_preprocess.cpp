@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_image_preprocess.hpp"
+
+#include <algorithm>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include "op/image_preprocess.hpp"
+
+#include "itt.hpp"
+
+namespace {
+
+using Attributes = ov::intel_cpu::ImagePreprocessNode::Attributes;
+
+bool isColorConvert(const std::shared_ptr<ngraph::Node>& node, Attributes& attrs) {
+    if (ov::is_type<ngraph::opset8::NV12toRGB>(node) || ov::is_type<ngraph::opset8::NV12toBGR>(node)) {
+        attrs.i420 = false;
+    } else if (ov::is_type<ngraph::opset8::I420toRGB>(node) || ov::is_type<ngraph::opset8::I420toBGR>(node)) {
+        attrs.i420 = true;
+    } else {
+        return false;
+    }
+    attrs.bgr = ov::is_type<ngraph::opset8::NV12toBGR>(node) || ov::is_type<ngraph::opset8::I420toBGR>(node);
+
+    const auto type = node->get_input_element_type(0);
+    return (type == ngraph::element::u8 || type == ngraph::element::f32) &&
+           node->get_input_partial_shape(0).is_static();
+}
+
+// Spatial resize of NHWC image, as inserted by PreProcessSteps::resize()
+bool isFusableResize(const std::shared_ptr<ngraph::Node>& node, Attributes& attrs) {
+    const auto interp = ov::as_type_ptr<ngraph::opset4::Interpolate>(node);
+    if (!interp || !interp->get_output_partial_shape(0).is_static())
+        return false;
+
+    using Interp = ngraph::opset4::Interpolate;
+    const auto& interpAttrs = interp->get_attrs();
+    const auto isZero = [](size_t v) { return v == 0; };
+    // the fused resize maps the coordinates by the sizes ratio, so the output shape must not be computed from scales
+    if (interpAttrs.shape_calculation_mode != Interp::ShapeCalcMode::SIZES ||
+        (interpAttrs.mode != Interp::InterpolateMode::LINEAR && interpAttrs.mode != Interp::InterpolateMode::NEAREST) ||
+        interpAttrs.coordinate_transformation_mode != Interp::CoordinateTransformMode::HALF_PIXEL ||
+        (interpAttrs.mode == Interp::InterpolateMode::NEAREST &&
+         interpAttrs.nearest_mode != Interp::NearestMode::ROUND_PREFER_FLOOR) ||
+        interpAttrs.antialias ||
+        !std::all_of(interpAttrs.pads_begin.begin(), interpAttrs.pads_begin.end(), isZero) ||
+        !std::all_of(interpAttrs.pads_end.begin(), interpAttrs.pads_end.end(), isZero))
+        return false;
+
+    const auto& inShape = interp->get_input_shape(0);
+    const auto& outShape = interp->get_output_shape(0);
+    if (interp->get_input_size() == 4) {
+        const auto axes = ov::as_type_ptr<ngraph::opset1::Constant>(interp->get_input_node_shared_ptr(3));
+        if (!axes || axes->cast_vector<int64_t>() != std::vector<int64_t>{1, 2})
+            return false;
+    } else if (inShape.size() != 4 || inShape[0] != outShape[0] || inShape[3] != outShape[3]) {
+        // without the axes input every axis is resized, only the spatial ones may change
+        return false;
+    }
+
+    attrs.out_height = static_cast<int64_t>(outShape[1]);
+    attrs.out_width = static_cast<int64_t>(outShape[2]);
+    attrs.linear = interpAttrs.mode == Interp::InterpolateMode::LINEAR;
+    attrs.round_resized = !interp->get_input_element_type(0).is_real();
+    return true;
+}
+
+// Mean/scale step: an elementwise op with a scalar or per-channel (last NHWC axis) constant
+bool isFusableAffine(const std::shared_ptr<ngraph::Node>& node, Attributes& attrs) {
+    const bool isSub = ov::is_type<ngraph::opset1::Subtract>(node);
+    const bool isDiv = ov::is_type<ngraph::opset1::Divide>(node);
+    const bool isAdd = ov::is_type<ngraph::opset1::Add>(node);
+    const bool isMul = ov::is_type<ngraph::opset1::Multiply>(node);
+    if (!isSub && !isDiv && !isAdd && !isMul)
+        return false;
+    if (node->get_output_element_type(0) != ngraph::element::f32 ||
+        node->get_output_partial_shape(0) != node->get_input_partial_shape(0))
+        return false;
+
+    const auto constant = ov::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+    if (!constant)
+        return false;
+    const auto& constShape = constant->get_shape();
+    if (constShape.size() > 4)
+        return false;
+    const auto values = constant->cast_vector<float>();
+    if (values.size() != 1) {
+        if (values.size() != 3 || constShape.back() != 3)
+            return false;
+    }
+
+    for (size_t c = 0; c < 3; c++) {
+        const float value = values[values.size() == 1 ? 0 : c];
+        if (isSub) {
+            attrs.shift[c] -= value;
+        } else if (isAdd) {
+            attrs.shift[c] += value;
+        } else if (isMul) {
+            attrs.scale[c] *= value;
+            attrs.shift[c] *= value;
+        } else {
+            attrs.scale[c] /= value;
+            attrs.shift[c] /= value;
+        }
+    }
+    return true;
+}
+
+bool isNHWCToNCHW(const std::shared_ptr<ngraph::Node>& node) {
+    if (!ov::is_type<ngraph::opset1::Transpose>(node))
+        return false;
+    const auto order = ov::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+    return order && order->cast_vector<int64_t>() == std::vector<int64_t>{0, 3, 1, 2};
+}
+
+}   // namespace
+
+bool ov::intel_cpu::FuseImagePreprocess::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(FuseImagePreprocess);
+    bool rewritten = false;
+    for (const auto& colorConvert : model->get_ordered_ops()) {
+        Attributes attrs;
+        if (!isColorConvert(colorConvert, attrs))
+            continue;
+
+        // walk the single-consumer chain after the color conversion and remember the longest f32 prefix,
+        // an integer-typed tail (e.g. resize before the element type conversion) can't be the fused output
+        ngraph::NodeVector chain{colorConvert};
+        size_t fusedSize = 0;
+        Attributes fusedAttrs;
+        bool resized = false, converted = false;
+        auto current = colorConvert;
+        while (!attrs.planar) {
+            const auto consumers = current->get_output_target_inputs(0);
+            if (consumers.size() != 1)
+                break;
+            const auto next = consumers.begin()->get_node()->shared_from_this();
+            if (!resized && isFusableResize(next, attrs)) {
+                resized = true;
+            } else if (!converted && ov::is_type<ngraph::opset1::Convert>(next) &&
+                       next->get_output_element_type(0) == ngraph::element::f32) {
+                converted = true;
+            } else if (isNHWCToNCHW(next)) {
+                attrs.planar = true;
+            } else if (!isFusableAffine(next, attrs)) {
+                break;
+            }
+            chain.push_back(next);
+            current = next;
+            if (current->get_output_element_type(0) == ngraph::element::f32) {
+                fusedSize = chain.size();
+                fusedAttrs = attrs;
+            }
+        }
+        if (fusedSize < 2)
+            continue;
+
+        chain.resize(fusedSize);
+        const auto& last = chain.back();
+        const auto fused = std::make_shared<ov::intel_cpu::ImagePreprocessNode>(colorConvert->input_values(), fusedAttrs);
+        fused->set_friendly_name(last->get_friendly_name());
+        ngraph::copy_runtime_info(chain, fused);
+        ngraph::replace_node(last, fused);
+        rewritten = true;
+    }
+    return rewritten;
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface FuseImagePreprocess
+ * @brief Replaces the chain produced by ov::preprocess::PrePostProcessor for NV12/I420 inputs
+ * (color conversion -> resize -> convert -> mean/scale -> NHWC to NCHW transpose, in any order the steps
+ * are valid in) with a single ImagePreprocessNode which does the whole preprocessing in one pass over the image.
+ * Must be applied before the common optimizations which decompose and move the elementwise part of the chain.
+ */
+class FuseImagePreprocess : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("FuseImagePreprocess", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::ImagePreprocessNode::ImagePreprocessNode(const ngraph::OutputVector& planes, const Attributes& attrs)
+    : Op(planes), m_attrs(attrs) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::ImagePreprocessNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ImagePreprocessNode>(new_args, m_attrs);
+}
+
+void ov::intel_cpu::ImagePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_validate_and_infer_types);
+    const auto planes = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+                          planes == 1 || planes == (m_attrs.i420 ? 3 : 2),
+                          "Unexpected number of image planes: ", planes);
+    NODE_VALIDATION_CHECK(this,
+                          m_attrs.scale.size() == 3 && m_attrs.shift.size() == 3,
+                          "Scale and shift must be defined per channel");
+
+    const auto& y_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, y_shape.rank().compatible(4), "Y plane must be NHWC 4D tensor");
+
+    ngraph::PartialShape out_shape = ngraph::PartialShape::dynamic(4);
+    if (y_shape.rank().is_static()) {
+        const auto batch = y_shape[0];
+        auto height = y_shape[1];
+        const auto width = y_shape[2];
+        if (planes == 1 && height.is_static())
+            height = height.get_length() * 2 / 3;
+        if (m_attrs.out_height > 0 && m_attrs.out_width > 0) {
+            out_shape = m_attrs.planar ? ngraph::PartialShape{batch, 3, m_attrs.out_height, m_attrs.out_width}
+                                       : ngraph::PartialShape{batch, m_attrs.out_height, m_attrs.out_width, 3};
+        } else {
+            out_shape = m_attrs.planar ? ngraph::PartialShape{batch, 3, height, width}
+                                       : ngraph::PartialShape{batch, height, width, 3};
+        }
+    }
+    set_output_type(0, ngraph::element::f32, out_shape);
+}
+
+bool ov::intel_cpu::ImagePreprocessNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_visit_attributes);
+    visitor.on_attribute("i420", m_attrs.i420);
+    visitor.on_attribute("bgr", m_attrs.bgr);
+    visitor.on_attribute("out_height", m_attrs.out_height);
+    visitor.on_attribute("out_width", m_attrs.out_width);
+    visitor.on_attribute("linear", m_attrs.linear);
+    visitor.on_attribute("round_resized", m_attrs.round_resized);
+    visitor.on_attribute("scale", m_attrs.scale);
+    visitor.on_attribute("shift", m_attrs.shift);
+    visitor.on_attribute("planar", m_attrs.planar);
+    return true;
+}
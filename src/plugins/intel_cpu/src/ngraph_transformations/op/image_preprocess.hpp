@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fused NV12/I420 image preprocessing: color conversion, optional spatial resize, per-channel
+ * affine normalization (x * scale + shift) and optional NHWC -> NCHW layout change.
+ * Inputs are the same planes as for NV12toRGB/I420toRGB family operations (NHWC, u8 or f32).
+ */
+class ImagePreprocessNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ImagePreprocess", "cpu_plugin_opset");
+
+    struct Attributes {
+        bool i420 = false;                  // NV12 otherwise
+        bool bgr = false;                   // RGB otherwise
+        int64_t out_height = 0;             // 0 - no resize
+        int64_t out_width = 0;
+        bool linear = true;                 // bilinear resize, nearest otherwise
+        bool round_resized = false;         // resize is computed in the integer precision of the input
+        std::vector<float> scale = {1.f, 1.f, 1.f};
+        std::vector<float> shift = {0.f, 0.f, 0.f};
+        bool planar = false;                // NCHW output, NHWC otherwise
+    };
+
+    ImagePreprocessNode() = default;
+
+    ImagePreprocessNode(const ngraph::OutputVector& planes, const Attributes& attrs);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const Attributes& get_attrs() const { return m_attrs; }
+
+private:
+    Attributes m_attrs;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
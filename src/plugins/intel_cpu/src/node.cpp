@@ -60,6 +60,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace dnnl;
 using namespace openvino;
@@ -1476,8 +1477,68 @@ std::vector<VectorDims> Node::shapeInfer() const {
     return shapeInferGeneric();
 }
 
+namespace {
+
+// Shape inference of a node is fully defined by its input shapes and the values of the inputs it reads
+struct ShapeInferKey {
+    const Node* node;
+    std::vector<VectorDims> inputShapes;
+    std::vector<uint8_t> inputValues;
+
+    size_t hash() const;
+    bool operator==(const ShapeInferKey& rhs) const;
+};
+
+size_t ShapeInferKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, node);
+    for (const auto& dims : inputShapes) {
+        seed = hash_combine(seed, dims.size());
+        for (auto dim : dims)
+            seed = hash_combine(seed, dim);
+    }
+    for (auto value : inputValues)
+        seed = hash_combine(seed, value);
+    return seed;
+}
+
+bool ShapeInferKey::operator==(const ShapeInferKey& rhs) const {
+    return node == rhs.node && inputShapes == rhs.inputShapes && inputValues == rhs.inputValues;
+}
+
+}   // namespace
+
 std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                                 uint32_t input_value_port_mask) const {
+    if (!rtParamsCache)
+        return shapeInferNoCache(input_shapes, input_value_port_mask);
+
+    // Dynamic models are often executed with a small set of repeating input shapes (e.g. bucketed sequence
+    // lengths), so the results are stored in the graph runtime cache and reused instead of being recomputed
+    // each time the input shapes change back to an already seen configuration.
+    ShapeInferKey key{this, {}, {}};
+    key.inputShapes.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes)
+        key.inputShapes.emplace_back(shape.to_shape());
+    for (size_t port = 0; port < input_shapes.size(); port++) {
+        if (input_value_port_mask & (1 << port)) {
+            const auto& mem = getParentEdgesAtPort(port)[0]->getMemory();
+            const auto data = static_cast<const uint8_t*>(mem.GetPtr());
+            key.inputValues.insert(key.inputValues.end(), data, data + mem.GetSize());
+        }
+    }
+
+    auto builder = [&](const ShapeInferKey&) {
+        return shapeInferNoCache(input_shapes, input_value_port_mask);
+    };
+    return rtParamsCache->getOrCreate(key, builder).first;
+}
+
+std::vector<VectorDims> Node::shapeInferNoCache(const std::vector<StaticShape>& input_shapes,
+                                                uint32_t input_value_port_mask) const {
     // collect input values
     std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
     if (input_value_port_mask) {
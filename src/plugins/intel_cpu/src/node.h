@@ -323,7 +323,7 @@ public:
         inplace = InPlaceType::Unknown;
     }
 
-    std::string getPrimitiveDescriptorType();
+    virtual std::string getPrimitiveDescriptorType();
 
     PerfCount &PerfCounter() { return perfCounter; }
 
@@ -792,6 +792,8 @@ private:
 
     std::vector<VectorDims> shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                               uint32_t input_value_port_mask) const;
+    std::vector<VectorDims> shapeInferNoCache(const std::vector<StaticShape>& input_shapes,
+                                              uint32_t input_value_port_mask) const;
 
 #ifdef CPU_DEBUG_CAPS
     friend class Verbose;
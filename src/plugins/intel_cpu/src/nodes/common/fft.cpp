@@ -0,0 +1,244 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ie_common.h"
+#include "ie_parallel.hpp"
+#include "cpu_memcpy.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+using Complex = FFTPlan::Complex;
+
+constexpr double PI = 3.141592653589793238462643;
+// transforms shorter than that are not worth splitting between threads
+constexpr size_t MIN_PARALLEL_SIZE = 1 << 14;
+
+// multiplication by -i
+inline Complex rotate(const Complex& v) {
+    return {v.imag(), -v.real()};
+}
+
+inline void butterfly2(Complex* v) {
+    const Complex a = v[0];
+    v[0] = a + v[1];
+    v[1] = a - v[1];
+}
+
+inline void butterfly3(Complex* v) {
+    const float s = 0.866025403784438646763723f;  // sin(2 * pi / 3)
+    const Complex sum = v[1] + v[2];
+    const Complex mid = v[0] - 0.5f * sum;
+    const Complex rot = rotate(v[1] - v[2]) * s;
+    v[0] += sum;
+    v[1] = mid + rot;
+    v[2] = mid - rot;
+}
+
+inline void butterfly4(Complex* v) {
+    const Complex t0 = v[0] + v[2];
+    const Complex t1 = v[0] - v[2];
+    const Complex t2 = v[1] + v[3];
+    const Complex t3 = rotate(v[1] - v[3]);
+    v[0] = t0 + t2;
+    v[1] = t1 + t3;
+    v[2] = t0 - t2;
+    v[3] = t1 - t3;
+}
+
+inline void butterfly5(Complex* v) {
+    const float c1 = 0.309016994374947424102293f;   // cos(2 * pi / 5)
+    const float c2 = -0.809016994374947424102293f;  // cos(4 * pi / 5)
+    const float s1 = 0.951056516295153572116439f;   // sin(2 * pi / 5)
+    const float s2 = 0.587785252292473129168706f;   // sin(4 * pi / 5)
+    const Complex b1 = v[1] + v[4];
+    const Complex b2 = v[2] + v[3];
+    const Complex d1 = v[1] - v[4];
+    const Complex d2 = v[2] - v[3];
+    const Complex m1 = v[0] + c1 * b1 + c2 * b2;
+    const Complex m2 = v[0] + c2 * b1 + c1 * b2;
+    const Complex r1 = rotate(s1 * d1 + s2 * d2);
+    const Complex r2 = rotate(s2 * d1 - s1 * d2);
+    v[0] += b1 + b2;
+    v[1] = m1 + r1;
+    v[4] = m1 - r1;
+    v[2] = m2 + r2;
+    v[3] = m2 - r2;
+}
+
+template <size_t R>
+inline void butterfly(Complex* v);
+template <>
+inline void butterfly<2>(Complex* v) { butterfly2(v); }
+template <>
+inline void butterfly<3>(Complex* v) { butterfly3(v); }
+template <>
+inline void butterfly<4>(Complex* v) { butterfly4(v); }
+template <>
+inline void butterfly<5>(Complex* v) { butterfly5(v); }
+
+/*
+ * One Stockham autosort stage: n / R butterflies, the j-th one reads src[j + r * n / R], r < R,
+ * multiplied by exp(-2 * pi * i * r * k / (stride * R)), k = j % stride, and writes the result
+ * to dst[(j / stride) * stride * R + k + r * stride]
+ */
+template <size_t R>
+void stockhamStage(const Complex* src, Complex* dst, size_t n, size_t stride, const Complex* twiddles,
+                   bool parallelize) {
+    const size_t butterflies = n / R;
+    auto butterflyAt = [&](size_t group, size_t k) {
+        const size_t j = group * stride + k;
+        const Complex* w = twiddles + k * (R - 1);
+        Complex v[R];
+        v[0] = src[j];
+        for (size_t r = 1; r < R; r++)
+            v[r] = src[j + r * butterflies] * w[r - 1];
+        butterfly<R>(v);
+        Complex* out = dst + group * stride * R + k;
+        for (size_t r = 0; r < R; r++)
+            out[r * stride] = v[r];
+    };
+
+    const size_t groups = butterflies / stride;
+    if (parallelize) {
+        InferenceEngine::parallel_for(butterflies, [&](size_t j) {
+            butterflyAt(j / stride, j % stride);
+        });
+    } else {
+        for (size_t group = 0; group < groups; group++) {
+            for (size_t k = 0; k < stride; k++)
+                butterflyAt(group, k);
+        }
+    }
+}
+
+inline void conjugate(Complex* data, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        data[i] = std::conj(data[i]);
+}
+
+}   // namespace
+
+FFTPlan::FFTPlan(size_t n) : n(n) {
+    if (n < 2)
+        return;
+
+    size_t rest = n;
+    std::vector<size_t> radixes;
+    for (size_t radix : {4, 2, 3, 5}) {
+        while (rest % radix == 0) {
+            radixes.push_back(radix);
+            rest /= radix;
+        }
+    }
+
+    if (rest == 1) {
+        size_t stride = 1;
+        for (size_t radix : radixes) {
+            stages.push_back({radix, stride, twiddles.size()});
+            for (size_t k = 0; k < stride; k++) {
+                for (size_t r = 1; r < radix; r++) {
+                    const double angle = -2.0 * PI * static_cast<double>(r * k) / static_cast<double>(stride * radix);
+                    twiddles.emplace_back(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+                }
+            }
+            stride *= radix;
+        }
+        return;
+    }
+
+    size_t convolutionSize = 1;
+    while (convolutionSize < 2 * n - 1)
+        convolutionSize *= 2;
+    convolutionPlan.reset(new FFTPlan(convolutionSize));
+
+    chirp.resize(n);
+    for (size_t k = 0; k < n; k++) {
+        // k^2 mod 2n keeps the angle exact for big k
+        const double angle = -PI * static_cast<double>((k * k) % (2 * n)) / static_cast<double>(n);
+        chirp[k] = Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+    }
+
+    chirpSpectrum.assign(convolutionSize, Complex(0.f, 0.f));
+    const float scale = 1.f / static_cast<float>(convolutionSize);
+    chirpSpectrum[0] = std::conj(chirp[0]) * scale;
+    for (size_t k = 1; k < n; k++) {
+        chirpSpectrum[k] = chirpSpectrum[convolutionSize - k] = std::conj(chirp[k]) * scale;
+    }
+    std::vector<Complex> scratch(convolutionPlan->scratchSize());
+    convolutionPlan->execute(reinterpret_cast<float*>(chirpSpectrum.data()),
+                             reinterpret_cast<float*>(scratch.data()), false);
+}
+
+size_t FFTPlan::scratchSize() const {
+    if (convolutionPlan)
+        return convolutionPlan->size() + convolutionPlan->scratchSize();
+    return n;
+}
+
+void FFTPlan::execute(float* data, float* scratch, bool inverse, bool parallelize) const {
+    // std::complex<float> is layout compatible with interleaved real and imaginary parts
+    auto* values = reinterpret_cast<Complex*>(data);
+    auto* buffer = reinterpret_cast<Complex*>(scratch);
+    parallelize = parallelize && n >= MIN_PARALLEL_SIZE;
+
+    // inverse transform is computed as conj(FFT(conj(x)))
+    if (inverse)
+        conjugate(values, n);
+    if (convolutionPlan) {
+        bluestein(values, buffer, parallelize);
+    } else {
+        stockham(values, buffer, parallelize);
+    }
+    if (inverse)
+        conjugate(values, n);
+}
+
+void FFTPlan::stockham(Complex* data, Complex* scratch, bool parallelize) const {
+    Complex* src = data;
+    Complex* dst = scratch;
+    for (const auto& stage : stages) {
+        const Complex* stageTwiddles = twiddles.data() + stage.twiddlesOffset;
+        switch (stage.radix) {
+        case 2: stockhamStage<2>(src, dst, n, stage.stride, stageTwiddles, parallelize); break;
+        case 3: stockhamStage<3>(src, dst, n, stage.stride, stageTwiddles, parallelize); break;
+        case 4: stockhamStage<4>(src, dst, n, stage.stride, stageTwiddles, parallelize); break;
+        case 5: stockhamStage<5>(src, dst, n, stage.stride, stageTwiddles, parallelize); break;
+        default: IE_THROW() << "Unexpected FFT radix " << stage.radix;
+        }
+        std::swap(src, dst);
+    }
+    if (src != data)
+        cpu_memcpy(data, src, n * sizeof(Complex));
+}
+
+void FFTPlan::bluestein(Complex* data, Complex* scratch, bool parallelize) const {
+    const size_t convolutionSize = convolutionPlan->size();
+    Complex* sequence = scratch;
+    float* convolutionScratch = reinterpret_cast<float*>(scratch + convolutionSize);
+
+    for (size_t k = 0; k < n; k++)
+        sequence[k] = data[k] * chirp[k];
+    std::fill(sequence + n, sequence + convolutionSize, Complex(0.f, 0.f));
+
+    // circular convolution with conj(chirp) through the spectra, the inverse FFT scale is in chirpSpectrum
+    auto* sequenceData = reinterpret_cast<float*>(sequence);
+    convolutionPlan->execute(sequenceData, convolutionScratch, false, parallelize);
+    for (size_t k = 0; k < convolutionSize; k++)
+        sequence[k] *= chirpSpectrum[k];
+    convolutionPlan->execute(sequenceData, convolutionScratch, true, parallelize);
+
+    for (size_t k = 0; k < n; k++)
+        data[k] = sequence[k] * chirp[k];
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
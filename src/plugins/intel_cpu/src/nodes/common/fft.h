@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Precomputed plan of a complex FFT of a fixed length.
+ * Lengths factorizable into 2, 3 and 5 are computed by the mixed radix (4, 2, 3, 5) Stockham algorithm with
+ * per stage twiddle tables. Other lengths are computed by Bluestein's algorithm, as a circular convolution
+ * with a chirp sequence using a power of two FFT, so every length takes O(n log n).
+ */
+class FFTPlan {
+public:
+    using Complex = std::complex<float>;
+
+    explicit FFTPlan(size_t n);
+
+    size_t size() const {
+        return n;
+    }
+
+    // number of complex values the scratch buffer passed to execute() has to hold
+    size_t scratchSize() const;
+
+    /**
+     * Unnormalized transform of n interleaved complex values in place:
+     * X[k] = sum(x[j] * exp(-+2 * pi * i * j * k / n)), the sign is positive for the inverse transform.
+     */
+    void execute(float* data, float* scratch, bool inverse, bool parallelize = false) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // product of the radixes of the previous stages
+        size_t stride;
+        size_t twiddlesOffset;
+    };
+
+    void stockham(Complex* data, Complex* scratch, bool parallelize) const;
+    void bluestein(Complex* data, Complex* scratch, bool parallelize) const;
+
+    size_t n;
+    std::vector<Stage> stages;
+    std::vector<Complex> twiddles;
+
+    // Bluestein's algorithm: chirp[k] = exp(-pi * i * k^2 / n) and the spectrum of its conjugate
+    // of the convolution length, scaled by 1 / convolution length
+    std::unique_ptr<FFTPlan> convolutionPlan;
+    std::vector<Complex> chirp;
+    std::vector<Complex> chirpSpectrum;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_utils.h"
+
+#include <algorithm>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// number of elements processed by one vectorizable pass, also the granularity of the early exit in NmsBoxes::suppresses
+constexpr size_t BLOCK_SIZE = 64;
+
+template <bool inclusive>
+size_t filterByScore(const float* scores, size_t count, float threshold, int* indices) {
+    size_t selected = 0;
+    for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+        const size_t blockSize = std::min(BLOCK_SIZE, count - start);
+        const float* block = scores + start;
+
+        unsigned char pass[BLOCK_SIZE];
+        unsigned char any = 0;
+        for (size_t i = 0; i < blockSize; i++) {
+            pass[i] = inclusive ? block[i] >= threshold : block[i] > threshold;
+            any |= pass[i];
+        }
+        if (!any)
+            continue;
+
+        for (size_t i = 0; i < blockSize; i++) {
+            indices[selected] = static_cast<int>(start + i);
+            selected += pass[i];
+        }
+    }
+    return selected;
+}
+
+/*
+ * IoU of the box with count boxes given by the coordinates arrays.
+ * The ratio is computed for all boxes first and the non-intersecting ones are zeroed by a separate pass:
+ * keeping the division out of the masked expression lets the compiler vectorize both loops.
+ */
+template <NmsBoxes::Overlap overlap>
+void iouImpl(const float* box, float area, const float* min0, const float* min1, const float* max0, const float* max1,
+             const float* areas, size_t count, float offset, float* out) {
+    const float boxMin0 = box[0];
+    const float boxMin1 = box[1];
+    const float boxMax0 = box[2];
+    const float boxMax1 = box[3];
+    const auto side0 = [&](size_t j) {
+        return (std::min)(boxMax0, max0[j]) - (std::max)(boxMin0, min0[j]) + offset;
+    };
+    const auto side1 = [&](size_t j) {
+        return (std::min)(boxMax1, max1[j]) - (std::max)(boxMin1, min1[j]) + offset;
+    };
+
+    for (size_t j = 0; j < count; j++) {
+        const float intersection = side0(j) * side1(j);
+        out[j] = intersection / (area + areas[j] - intersection);
+    }
+    for (size_t j = 0; j < count; j++) {
+        const bool intersects = overlap == NmsBoxes::Overlap::Positive
+            ? (side0(j) > 0.f) & (side1(j) > 0.f)
+            : (min0[j] <= boxMax0) & (max0[j] >= boxMin0) & (min1[j] <= boxMax1) & (max1[j] >= boxMin1);
+        out[j] = intersects ? out[j] : 0.f;
+    }
+}
+
+}   // namespace
+
+size_t filterByScore(const float* scores, size_t count, float threshold, bool inclusive, int* indices) {
+    return inclusive ? filterByScore<true>(scores, count, threshold, indices)
+                     : filterByScore<false>(scores, count, threshold, indices);
+}
+
+size_t topKByScore(int* indices, size_t count, size_t k, const float* scores) {
+    const auto greater = [scores](int l, int r) {
+        return scores[l] > scores[r] || (scores[l] == scores[r] && l < r);
+    };
+    if (k < count) {
+        std::nth_element(indices, indices + k, indices + count, greater);
+    } else {
+        k = count;
+    }
+    std::sort(indices, indices + k, greater);
+    return k;
+}
+
+NmsBoxes::NmsBoxes(Overlap overlap, float offset) : overlap(overlap), offset(offset) {}
+
+void NmsBoxes::reserve(size_t count) {
+    for (auto* values : {&min0, &min1, &max0, &max1, &areas})
+        values->reserve(count);
+}
+
+void NmsBoxes::clear() {
+    for (auto* values : {&min0, &min1, &max0, &max1, &areas})
+        values->clear();
+}
+
+void NmsBoxes::push_back(const float* box, float area) {
+    min0.push_back(box[0]);
+    min1.push_back(box[1]);
+    max0.push_back(box[2]);
+    max1.push_back(box[3]);
+    areas.push_back(area);
+}
+
+bool NmsBoxes::suppresses(const float* box, float area, float threshold, bool inclusive, size_t begin) const {
+    float values[BLOCK_SIZE];
+    for (size_t start = begin; start < size(); start += BLOCK_SIZE) {
+        const size_t blockSize = std::min(BLOCK_SIZE, size() - start);
+        iou(box, area, start, start + blockSize, values);
+
+        unsigned char suppressed = 0;
+        if (inclusive) {
+            for (size_t j = 0; j < blockSize; j++)
+                suppressed |= values[j] >= threshold;
+        } else {
+            for (size_t j = 0; j < blockSize; j++)
+                suppressed |= values[j] > threshold;
+        }
+        if (suppressed)
+            return true;
+    }
+    return false;
+}
+
+void NmsBoxes::iou(const float* box, float area, size_t count, float* out) const {
+    iou(box, area, 0, count, out);
+}
+
+void NmsBoxes::iou(const float* box, float area, size_t begin, size_t end, float* out) const {
+    const size_t count = end - begin;
+    if (overlap == Overlap::Positive) {
+        iouImpl<Overlap::Positive>(box, area, min0.data() + begin, min1.data() + begin, max0.data() + begin,
+                                   max1.data() + begin, areas.data() + begin, count, offset, out);
+    } else {
+        iouImpl<Overlap::Touching>(box, area, min0.data() + begin, min1.data() + begin, max0.data() + begin,
+                                   max1.data() + begin, areas.data() + begin, count, offset, out);
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
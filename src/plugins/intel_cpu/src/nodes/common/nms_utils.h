@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Writes the ascending indices i of scores[i] > threshold (scores[i] >= threshold if inclusive) and returns their number.
+ * Scores are tested block by block by a vectorizable loop, so blocks without candidates are skipped without per element branches.
+ */
+size_t filterByScore(const float* scores, size_t count, float threshold, bool inclusive, int* indices);
+
+/**
+ * Reorders indices, so that the first min(k, count) of them refer to the highest scores in the descending order,
+ * equal scores are ordered by the index. Returns min(k, count).
+ */
+size_t topKByScore(int* indices, size_t count, size_t k, const float* scores);
+
+/**
+ * Boxes of the NMS family operations in the structure of arrays layout, so IoU of a box against the stored ones
+ * is computed by vectorizable loops. A box is [min0, min1, max0, max1], the area is computed by the caller.
+ */
+class NmsBoxes {
+public:
+    enum class Overlap {
+        // boxes intersect if both sides of the intersection are positive
+        Positive,
+        // boxes intersect unless they are separated along an axis, so the touching ones intersect too
+        Touching,
+    };
+
+    // offset is added to the sides of the intersection, it is 1 for not normalized coordinates
+    NmsBoxes(Overlap overlap, float offset);
+
+    size_t size() const {
+        return areas.size();
+    }
+
+    void reserve(size_t count);
+    void clear();
+    void push_back(const float* box, float area);
+
+    // true if IoU of the box with any of the stored boxes starting from begin is above the threshold
+    bool suppresses(const float* box, float area, float threshold, bool inclusive, size_t begin = 0) const;
+
+    // IoU of the box with the first count stored boxes
+    void iou(const float* box, float area, size_t count, float* out) const;
+
+private:
+    void iou(const float* box, float area, size_t begin, size_t end, float* out) const;
+
+    Overlap overlap;
+    float offset;
+    std::vector<float> min0;
+    std::vector<float> min1;
+    std::vector<float> max0;
+    std::vector<float> max1;
+    std::vector<float> areas;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ordered_scatter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "cpu_memcpy.h"
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// number of the offsets sampled per thread to choose the destination ranges of the threads
+constexpr size_t samplesPerOwner = 256;
+
+// copies the updates of the given positions (all of them in order if positions is nullptr) skipping the out of range
+// offsets, the element sized blocks are copied by typed loads and stores
+template <typename T>
+void applyUpdates(uint8_t* dst, size_t dstBlocks, const uint8_t* update, const size_t* dstOffsets,
+                  const size_t* positions, size_t count) {
+    auto* dstData = reinterpret_cast<T*>(dst);
+    const auto* updateData = reinterpret_cast<const T*>(update);
+    for (size_t i = 0; i < count; i++) {
+        const size_t t = positions ? positions[i] : i;
+        if (dstOffsets[t] < dstBlocks)
+            dstData[dstOffsets[t]] = updateData[t];
+    }
+}
+
+void applyUpdates(uint8_t* dst, size_t dstBlocks, const uint8_t* update, const size_t* dstOffsets,
+                  const size_t* positions, size_t count, size_t blockSize) {
+    switch (blockSize) {
+    case 1: applyUpdates<uint8_t>(dst, dstBlocks, update, dstOffsets, positions, count); break;
+    case 2: applyUpdates<uint16_t>(dst, dstBlocks, update, dstOffsets, positions, count); break;
+    case 4: applyUpdates<uint32_t>(dst, dstBlocks, update, dstOffsets, positions, count); break;
+    case 8: applyUpdates<uint64_t>(dst, dstBlocks, update, dstOffsets, positions, count); break;
+    default:
+        for (size_t i = 0; i < count; i++) {
+            const size_t t = positions ? positions[i] : i;
+            if (dstOffsets[t] < dstBlocks)
+                cpu_memcpy(dst + dstOffsets[t] * blockSize, update + t * blockSize, blockSize);
+        }
+    }
+}
+
+}   // namespace
+
+void scatterBlocks(uint8_t* dst, size_t dstBlocks, const uint8_t* update, const size_t* dstOffsets, size_t count,
+                   size_t blockSize) {
+    if (count == 0 || dstBlocks == 0)
+        return;
+
+    const size_t owners = std::min(static_cast<size_t>(parallel_get_max_threads()), std::min(dstBlocks, count));
+    if (owners == 1) {
+        applyUpdates(dst, dstBlocks, update, dstOffsets, nullptr, count, blockSize);
+        return;
+    }
+    // the updates are split between the same number of the threads into consecutive chunks
+    const size_t chunks = owners;
+
+    // the owner o gets the destination blocks [ownerFirst[o - 1], ownerFirst[o]), the bounds are the quantiles of
+    // a sample of the offsets, so the skewed offsets are shared by several owners instead of the one owning their range
+    std::vector<size_t> sample;
+    const size_t sampleStep = std::max<size_t>(1, count / (owners * samplesPerOwner));
+    for (size_t t = 0; t < count; t += sampleStep) {
+        if (dstOffsets[t] < dstBlocks)
+            sample.push_back(dstOffsets[t]);
+    }
+    std::sort(sample.begin(), sample.end());
+    std::vector<size_t> ownerFirst(owners - 1);
+    for (size_t o = 1; o < owners; o++)
+        ownerFirst[o - 1] = sample.empty() ? dstBlocks : sample[o * sample.size() / owners];
+    // the number of the bounds not greater than the offset, the search is branchless since the skewed offsets make
+    // the branches unpredictable
+    const size_t* bounds = ownerFirst.data();
+    const size_t boundCount = ownerFirst.size();
+    auto ownerOf = [bounds, boundCount](size_t offset) {
+        const size_t* base = bounds;
+        size_t n = boundCount;
+        while (n > 1) {
+            const size_t half = n / 2;
+            base = base[half] <= offset ? base + half : base;
+            n -= half;
+        }
+        return static_cast<size_t>(base - bounds) + (*base <= offset);
+    };
+
+    // bucketStart[c * owners + o] is the number of the updates of the chunk c owned by o, then their first position
+    std::vector<size_t> bucketStart(chunks * owners, 0);
+    parallel_for(chunks, [&](size_t c) {
+        size_t start = 0, end = 0;
+        splitter(count, chunks, c, start, end);
+        size_t* counts = &bucketStart[c * owners];
+        for (size_t t = start; t < end; t++) {
+            if (dstOffsets[t] < dstBlocks)
+                counts[ownerOf(dstOffsets[t])]++;
+        }
+    });
+
+    // the positions are grouped by the owner, then by the chunk, so every owner sees its updates in their order
+    std::vector<size_t> ownerStart(owners + 1, 0);
+    size_t total = 0;
+    for (size_t o = 0; o < owners; o++) {
+        ownerStart[o] = total;
+        for (size_t c = 0; c < chunks; c++) {
+            const size_t chunkCount = bucketStart[c * owners + o];
+            bucketStart[c * owners + o] = total;
+            total += chunkCount;
+        }
+    }
+    ownerStart[owners] = total;
+
+    std::vector<size_t> positions(total);
+    parallel_for(chunks, [&](size_t c) {
+        size_t start = 0, end = 0;
+        splitter(count, chunks, c, start, end);
+        size_t* next = &bucketStart[c * owners];
+        for (size_t t = start; t < end; t++) {
+            if (dstOffsets[t] < dstBlocks)
+                positions[next[ownerOf(dstOffsets[t])]++] = t;
+        }
+    });
+
+    parallel_for(owners, [&](size_t o) {
+        applyUpdates(dst, dstBlocks, update, dstOffsets, positions.data() + ownerStart[o],
+                     ownerStart[o + 1] - ownerStart[o], blockSize);
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Copies the blocks of blockSize bytes update[t] into dst[dstOffsets[t]] for t in [0, count) as if they were copied
+ * sequentially, so the last of the updates with the same offset wins. Offsets are in blocks, the offsets out of
+ * [0, dstBlocks) are skipped.
+ * The updates are distributed between the threads by the destination range they fall into (keeping their order),
+ * then every thread applies its own updates, so the threads never write the same block and the result is
+ * deterministic for the duplicate offsets. The ranges are chosen from the distribution of the offsets, so that the
+ * threads get about the same number of the updates.
+ */
+void scatterBlocks(uint8_t* dst, size_t dstBlocks, const uint8_t* update, const size_t* dstOffsets, size_t count,
+                   size_t blockSize);
+
+}   // namespace intel_cpu
+}   // namespace ov
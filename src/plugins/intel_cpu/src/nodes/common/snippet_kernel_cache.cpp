@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippet_kernel_cache.h"
+
+#include <sstream>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <common/primitive_hashing_utils.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// Writes the attribute values to the body signature, so the nodes with equal attributes get equal signatures
+class SignatureVisitor : public ov::AttributeVisitor {
+public:
+    explicit SignatureVisitor(std::ostream& os) : os(os) {
+        os << std::hexfloat;
+    }
+
+    // There is no way to compare the values of unknown types, so the body can't be shared
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        complete = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<void*>& adapter) override {
+        os << name << "=";
+        os.write(static_cast<const char*>(adapter.get_ptr()), adapter.size());
+        os << ";";
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override { write(name, static_cast<int>(adapter.get())); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override { write(name, static_cast<int>(adapter.get())); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override { write(name, adapter.get()); }
+
+    bool is_complete() const { return complete; }
+
+private:
+    template <typename T>
+    void write(const std::string& name, const T& value) {
+        os << name << "=" << value << ";";
+    }
+    template <typename T>
+    void write(const std::string& name, const std::vector<T>& values) {
+        os << name << "=[";
+        for (const auto& value : values)
+            os << value << ",";
+        os << "];";
+    }
+
+    std::ostream& os;
+    bool complete = true;
+};
+
+}   // namespace
+
+bool getSnippetBodySignature(const ngraph::snippets::op::Subgraph& snippet, std::string& signature) {
+    // Shapes affect the generated code only via the broadcasting pattern (it's a part of the key),
+    // except for the reductions which are unrolled with the innermost dimension
+    std::ostringstream os;
+    SignatureVisitor visitor(os);
+    const bool hasReductions = snippet.has_reductions();
+    std::unordered_map<const ov::Node*, size_t> indices;
+    for (const auto& op : snippet.get_body()->get_ordered_ops()) {
+        const size_t index = indices.size();
+        indices[op.get()] = index;
+        os << op->get_type_info() << "(";
+        for (const auto& input : op->input_values())
+            os << indices.at(input.get_node()) << ":" << input.get_index() << ",";
+        os << ")->(";
+        for (const auto& output : op->outputs()) {
+            const auto& shape = output.get_partial_shape();
+            os << output.get_element_type() << ":" << shape.rank();
+            if (hasReductions && shape.rank().is_static() && shape.rank().get_length() > 0)
+                os << ":" << shape[shape.rank().get_length() - 1];
+            os << ",";
+        }
+        os << "){";
+        // Parameter attributes are its shape and type, they are already handled above
+        if (!ov::is_type<ngraph::opset1::Parameter>(op) && !op->visit_attributes(visitor))
+            return false;
+        os << "}";
+    }
+    if (!visitor.is_complete())
+        return false;
+    signature = os.str();
+    return true;
+}
+
+size_t SharedKernelKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, std::hash<std::string>()(bodySignature));
+    for (const bool isBroadcasted : broadcastingPattern)
+        seed = hash_combine(seed, isBroadcasted);
+    seed = hash_combine(seed, harnessNumDims);
+    seed = hash_combine(seed, isa);
+    return seed;
+}
+
+bool SharedKernelKey::operator==(const SharedKernelKey& rhs) const {
+    return bodySignature == rhs.bodySignature &&
+           broadcastingPattern == rhs.broadcastingPattern &&
+           harnessNumDims == rhs.harnessNumDims &&
+           isa == rhs.isa;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <snippets/op/subgraph.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Describes the body of the canonicalized subgraph independently of the node names: the op types, attributes,
+ * connections, element types and ranks (and the innermost dimensions if the body has reductions).
+ * Returns false if the body can't be described (an attribute of unknown type), then the generated code can't be shared.
+ */
+bool getSnippetBodySignature(const ngraph::snippets::op::Subgraph& snippet, std::string& signature);
+
+// Generated code depends only on the body structure (not on the node it belongs to), so the kernels are shared
+// by all the nodes with equal bodies, including the nodes from different streams and models
+struct SharedKernelKey {
+    std::string bodySignature;
+    std::vector<bool> broadcastingPattern;
+    size_t harnessNumDims;
+    int isa;
+
+    size_t hash() const;
+    bool operator==(const SharedKernelKey& rhs) const;
+};
+
+// The counters show how many kernels were reused or generated and how many are alive now
+struct SharedKernelCacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t size = 0;
+};
+
+/**
+ * @brief Storage of generated snippets kernels.
+ * Only weak references are stored, so a kernel lives while at least one node uses it.
+ */
+template <typename Kernel>
+class SharedKernelCache {
+public:
+    using KernelPtr = std::shared_ptr<Kernel>;
+
+    // process-wide instance used by the Snippet nodes
+    static SharedKernelCache& getInstance() {
+        static SharedKernelCache cache;
+        return cache;
+    }
+
+    template <typename BuilderType>
+    KernelPtr getOrCreate(const SharedKernelKey& key, BuilderType builder) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto found = kernels.find(key);
+            if (found != kernels.end()) {
+                if (auto kernel = found->second.lock()) {
+                    hits++;
+                    return kernel;
+                }
+            }
+            misses++;
+        }
+        // Code generation may take a while, so it's performed without the lock.
+        // If the same kernel is generated concurrently, the first registered one is shared
+        auto kernel = builder();
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = kernels.begin(); it != kernels.end();) {
+            if (it->second.expired())
+                it = kernels.erase(it);
+            else
+                it++;
+        }
+        const auto inserted = kernels.emplace(key, kernel);
+        return inserted.second ? kernel : inserted.first->second.lock();
+    }
+
+    SharedKernelCacheStatistics getStatistics() {
+        std::lock_guard<std::mutex> lock(mutex);
+        SharedKernelCacheStatistics statistics;
+        statistics.hits = hits;
+        statistics.misses = misses;
+        statistics.size = std::count_if(kernels.begin(), kernels.end(),
+                                        [](const std::pair<const SharedKernelKey, std::weak_ptr<Kernel>>& kernel) {
+                                            return !kernel.second.expired();
+                                        });
+        return statistics;
+    }
+
+private:
+    struct KeyHasher {
+        size_t operator()(const SharedKernelKey& key) const { return key.hash(); }
+    };
+
+    std::mutex mutex;
+    std::unordered_map<SharedKernelKey, std::weak_ptr<Kernel>, KeyHasher> kernels;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_weights.h"
+
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+constexpr size_t SparseWeights::MAX_ROWS_CHUNK;
+
+SparseWeights::SparseWeights(const float* weights, size_t OC, size_t IC) : OC(OC), IC(IC) {
+    rowOffsets.resize(OC + 1);
+    rowOffsets[0] = 0;
+    for (size_t oc = 0; oc < OC; oc++) {
+        const float* row = weights + oc * IC;
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (row[ic] != 0.f) {
+                columns.push_back(static_cast<int>(ic));
+                values.push_back(row[ic]);
+            }
+        }
+        rowOffsets[oc + 1] = values.size();
+    }
+}
+
+float SparseWeights::sparsity(const float* weights, size_t size) {
+    if (size == 0)
+        return 0.f;
+    size_t zeros = 0;
+    for (size_t i = 0; i < size; i++)
+        zeros += weights[i] == 0.f;
+    return static_cast<float>(zeros) / static_cast<float>(size);
+}
+
+void SparseWeights::execute(const float* src, const float* bias, float* dst, size_t M, float* scratch) const {
+    for (size_t start = 0; start < M; start += MAX_ROWS_CHUNK) {
+        const size_t rows = (std::min)(MAX_ROWS_CHUNK, M - start);
+        const float* chunkSrc = src + start * IC;
+        float* chunkDst = dst + start * OC;
+
+        // the input column ic is columnsData[ic * rows, (ic + 1) * rows)
+        const float* columnsData = chunkSrc;
+        if (rows > 1) {
+            InferenceEngine::parallel_for(IC, [&](size_t ic) {
+                for (size_t m = 0; m < rows; m++)
+                    scratch[ic * rows + m] = chunkSrc[m * IC + ic];
+            });
+            columnsData = scratch;
+        }
+
+        InferenceEngine::parallel_for(OC, [&](size_t oc) {
+            const float b = bias ? bias[oc] : 0.f;
+            const size_t begin = rowOffsets[oc];
+            const size_t end = rowOffsets[oc + 1];
+            if (rows == 1) {
+                float sum = b;
+                for (size_t k = begin; k < end; k++)
+                    sum += values[k] * columnsData[columns[k]];
+                chunkDst[oc] = sum;
+                return;
+            }
+
+            float acc[MAX_ROWS_CHUNK];
+            for (size_t m = 0; m < rows; m++)
+                acc[m] = b;
+            for (size_t k = begin; k < end; k++) {
+                const float w = values[k];
+                const float* column = columnsData + static_cast<size_t>(columns[k]) * rows;
+                for (size_t m = 0; m < rows; m++)
+                    acc[m] += w * column[m];
+            }
+            for (size_t m = 0; m < rows; m++)
+                chunkDst[m * OC + oc] = acc[m];
+        });
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fully connected weights [OC, IC] with the zero values dropped (compressed sparse rows).
+ * The product reads only the non zero weights, so it pays off for highly sparse (pruned) weights
+ * and a small number of the input rows, when the dense product is bound by reading the weights.
+ */
+class SparseWeights {
+public:
+    // the product keeps an accumulator per input row on the stack, bigger inputs are split into chunks of that size
+    static constexpr size_t MAX_ROWS_CHUNK = 16;
+
+    SparseWeights(const float* weights, size_t OC, size_t IC);
+
+    // share of the zero values
+    static float sparsity(const float* weights, size_t size);
+
+    size_t nonZeros() const {
+        return values.size();
+    }
+
+    /**
+     * dst[m, oc] = sum(src[m, ic] * weights[oc, ic]) + bias[oc], src is [M, IC], dst is [M, OC], bias may be nullptr.
+     * Each non zero weight is multiplied with its input column of all the rows by a vectorizable loop,
+     * so the input is transposed into the scratch buffer of scratchSize(M) values if M > 1.
+     */
+    void execute(const float* src, const float* bias, float* dst, size_t M, float* scratch) const;
+
+    size_t scratchSize(size_t M) const {
+        return M > 1 ? (std::min)(M, MAX_ROWS_CHUNK) * IC : 0;
+    }
+
+private:
+    size_t OC;
+    size_t IC;
+    // non zero weights of the output channel oc are [rowOffsets[oc], rowOffsets[oc + 1])
+    std::vector<size_t> rowOffsets;
+    std::vector<int> columns;
+    std::vector<float> values;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
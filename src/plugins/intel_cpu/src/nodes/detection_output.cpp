@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -10,6 +11,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "detection_output.h"
+#include "common/nms_utils.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -152,18 +154,6 @@ void DetectionOutput::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
-struct ConfidenceComparatorDO {
-    explicit ConfidenceComparatorDO(const float* confDataIn) : confData(confDataIn) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (confData[idx1] > confData[idx2]) return true;
-        if (confData[idx1] < confData[idx2]) return false;
-        return idx1 < idx2;
-    }
-
-    const float* confData;
-};
-
 void DetectionOutput::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -265,29 +255,31 @@ void DetectionOutput::execute(dnnl::stream strm) {
     }
 
     // NMS
-    for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
-                if (c != backgroundClassId) {  // Ignore background class
-                    int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pdetections = detectionsData + n * classesNum + c;
-
-                    const float *pboxes;
-                    const float *psizes;
-                    if (isShareLoc) {
-                        pboxes = decodedBboxesData + n * 4 * priorsNum;
-                        psizes = bboxSizesData + n * priorsNum;
-                    } else {
-                        pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
-                        psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
-                    }
-
-                    NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+    if (!decreaseClassId) {
+        // Caffe style
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                int *pdetections = detectionsData + n * classesNum + c;
+
+                const float *pboxes;
+                const float *psizes;
+                if (isShareLoc) {
+                    pboxes = decodedBboxesData + n * 4 * priorsNum;
+                    psizes = bboxSizesData + n * priorsNum;
+                } else {
+                    pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+                    psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
                 }
-            });
-        } else {
+
+                NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+            }
+        });
+    }
+
+    for (int n = 0; n < imgNum; ++n) {
+        if (decreaseClassId) {
             // MXNet style
             int *pbuffer = indicesBufData + n * classesNum * priorsNum;
             int *pdetections = detectionsData + n * classesNum;
@@ -306,9 +298,9 @@ void DetectionOutput::execute(dnnl::stream strm) {
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
             std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            confIndicesClassMap.reserve(detectionsTotal);
 
-            std::mutex mtx;
-            parallel_for(classesNum, [&](int c) {
+            for (int c = 0; c < classesNum; ++c) {
                 int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
 
@@ -316,14 +308,13 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
                     confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
                 }
-            });
+            }
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only the first keepTopK detections are kept, so there is no need to sort the rest
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
@@ -393,13 +384,7 @@ inline void DetectionOutput::confFilterCF(float* reorderedConfData, int* indices
         int *pindices = indicesData + off;
         int *pbuffer = indicesBufData + off;
 
-        int count = 0;
-        for (int i = 0; i < numPriorsActual[n]; ++i) {
-            if (pconf[i] > confidenceThreshold) {
-                pindices[count] = i;
-                count++;
-            }
-        }
+        int count = static_cast<int>(filterByScore(pconf, numPriorsActual[n], confidenceThreshold, false, pindices));
 
         // in:  pindices count
         // out: buffer detectionCount
@@ -720,46 +705,8 @@ inline void DetectionOutput::decodeBBoxes(const float *priorData,
 }
 
 inline void DetectionOutput::topk(const int *indicesIn, int *indicesOut, const float *conf, int n, int k) {
-    std::partial_sort_copy(indicesIn, indicesIn + n,
-                           indicesOut, indicesOut + k,
-                           ConfidenceComparatorDO(conf));
-}
-
-static inline float JaccardOverlap(const float *decodedBbox,
-                                   const float *bboxSizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decodedBbox[idx1 * 4 + 0];
-    float ymin1 = decodedBbox[idx1 * 4 + 1];
-    float xmax1 = decodedBbox[idx1 * 4 + 2];
-    float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    float xmin2 = decodedBbox[idx2 * 4 + 0];
-    float ymin2 = decodedBbox[idx2 * 4 + 1];
-    float xmax2 = decodedBbox[idx2 * 4 + 2];
-    float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth  = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
-
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0f;
-    }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
+    std::copy(indicesIn, indicesIn + n, indicesOut);
+    topKByScore(indicesOut, n, k, conf);
 }
 
 inline void DetectionOutput::NMSCF(int* indicesIn,
@@ -770,22 +717,17 @@ inline void DetectionOutput::NMSCF(int* indicesIn,
     // nms for this class
     int countIn = detections;
     detections = 0;
+    NmsBoxes keptBoxes(NmsBoxes::Overlap::Positive, 0.f);
+    keptBoxes.reserve(countIn);
     for (int i = 0; i < countIn; ++i) {
         const int prior = indicesIn[i];
+        const float *bbox = bboxes + prior * 4;
+        if (keptBoxes.suppresses(bbox, boxSizes[prior], NMSThreshold, false))
+            continue;
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indicesOut[detections] = prior;
-            detections++;
-        }
+        keptBoxes.push_back(bbox, boxSizes[prior]);
+        indicesOut[detections] = prior;
+        detections++;
     }
 }
 
@@ -798,6 +740,7 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
     int countIn = detections[0];
     detections[0] = 0;
 
+    std::vector<NmsBoxes> keptBoxes(classesNum, NmsBoxes(NmsBoxes::Overlap::Positive, 0.f));
     for (int i = 0; i < countIn; ++i) {
         const int idx = indicesIn[i];
         const int cls = idx / priorsNum;
@@ -807,24 +750,13 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
         int &ndetection = detections[cls];
         int *pindices = indicesOut + cls * priorsNum;
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0f;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
+        const int bboxIdx = isShareLoc ? prior : cls * priorsNum + prior;
+        const float *bbox = bboxes + bboxIdx * 4;
+        if (keptBoxes[cls].suppresses(bbox, sizes[bboxIdx], NMSThreshold, false))
+            continue;
 
-        if (keep) {
-            pindices[ndetection++] = prior;
-        }
+        keptBoxes[cls].push_back(bbox, sizes[bboxIdx]);
+        pindices[ndetection++] = prior;
     }
 }
 
@@ -109,14 +109,6 @@ void DFT::initSupportedPrimitiveDescriptors() {
 }
 
 namespace {
-inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsReal - lhsImag * rhsImag;
-}
-
-inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsImag + lhsImag * rhsReal;
-}
-
 /*
     Returns true while we can iterate
     Specified axis is skipped in counters   
@@ -141,10 +133,6 @@ inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<s
     return false;
 }
 
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
-}
-
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
     auto itCounter = counters.rbegin();
     auto itWork = iterationRange.rbegin();
@@ -241,12 +229,18 @@ void DFT::execute(dnnl::stream strm) {
     std::sort(axes.begin(), axes.end());
 
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    // every thread gathers a line of the transformed axis and runs the FFT in its own part of fftBuffers
+    size_t bufferSize = 0;
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
+        if (fftPlans.find(nComplex) == fftPlans.end()) {
+            fftPlans[nComplex] = std::make_shared<FFTPlan>(nComplex);
         }
+        bufferSize = std::max(bufferSize, 2 * (nComplex + fftPlans[nComplex]->scratchSize()));
+    }
+    const size_t buffersNumber = parallel_get_max_threads();
+    if (fftBuffers.size() < bufferSize * buffersNumber) {
+        fftBuffers.resize(bufferSize * buffersNumber);
     }
 
     auto inputDataEdge = getParentEdgeAt(DATA_INDEX);
@@ -265,156 +259,46 @@ void DFT::execute(dnnl::stream strm) {
 
     // 1d case
     if (inputDataEdge->getMemory().GetShape().getRank() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
+        fft(output, fftBuffers.data(), *fftPlans.at(outputShape[0]), true);
     } else {
-        dftNd(output, outputStrides);
+        dftNd(output, outputStrides, bufferSize);
     }
 }
 
-void DFT::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
+void DFT::dftNd(float* output, const std::vector<size_t>& outputStrides, size_t bufferSize) {
     const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
     const size_t lastDimIndex = iterationRange.size() - 1;
     for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
         const size_t currentAxis = axes[axisIndex];
         const size_t outputComplexLen = outputShape[currentAxis];
-        const size_t outputLen = outputComplexLen * 2;
-
-        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        }
-    }
-}
-
-/* Cooley Tukey implementation of FFT */
-void DFT::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
 
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
+        const auto& plan = *fftPlans.at(outputComplexLen);
 
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
-
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
-        }
-    };
-
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
+        size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
+        do {
+            parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
+                float* gatheredData = &fftBuffers[parallel_get_thread_num() * bufferSize];
+                float* scratch = gatheredData + 2 * outputComplexLen;
+                auto parallelIterationCounter = iterationCounter;
+                parallelIterationCounter[parallelDimIndex] = dim;
+                gatherToBufferND(gatheredData, output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+                fft(gatheredData, scratch, plan);
+                applyBufferND(gatheredData, output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
             });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            }
-        }
+            iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
+        } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
     }
-
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
-        }
-        data[k] = outBufferStart[k];
-    }
-}
-
-void DFT::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
 }
 
-std::vector<std::pair<float, float>> DFT::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
+void DFT::fft(float* data, float* scratch, const FFTPlan& plan, bool parallelize) const {
+    plan.execute(data, scratch, inverse, parallelize);
+    if (inverse) {
+        const size_t dataLength = plan.size() * 2;
+        const float scale = 1.f / static_cast<float>(plan.size());
+        for (size_t k = 0; k < dataLength; k++)
+            data[k] *= scale;
+    }
 }
 
 bool DFT::created() const {
@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <node.h>
 #include <string>
+#include "common/fft.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -26,13 +27,13 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
-    void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
+    void dftNd(float* output, const std::vector<size_t>& outputStrides, size_t bufferSize);
+    void fft(float* data, float* scratch, const FFTPlan& plan, bool parallelize = false) const;
 
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
-
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // FFT plans for the transformed lengths, built on the first use of a length
+    std::unordered_map<size_t, std::shared_ptr<FFTPlan>> fftPlans;
+    // per thread working memory of the transforms, kept between the inferences
+    std::vector<float> fftBuffers;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -40,7 +41,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
@@ -5,6 +5,7 @@
 #include "fullyconnected.h"
 #include "eltwise.h"
 #include "fake_quantize.h"
+#include "input.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
@@ -158,6 +159,10 @@ VectorDims FullyConnected::makeDummyOutputDims(const VectorDims& inDims) const {
     return shapeInferGeneric(inShapes).front();
 }
 
+void FullyConnected::init() {
+    useSparseWeights = isSparseWeightsApplicable();
+}
+
 void FullyConnected::getSupportedDescriptors() {
     if (getParentEdges().size() != 2 && getParentEdges().size() != 3)
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
@@ -192,6 +197,15 @@ void FullyConnected::getSupportedDescriptors() {
         outputDataType = memory::data_type::bf16;
     }
 
+    sparseWeights.reset();
+    const auto weightsNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (useSparseWeights && weightsNode && fusedWith.empty() &&
+        inputDataType == memory::data_type::f32 && outputDataType == memory::data_type::f32) {
+        const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+        sparseWeights = std::make_shared<SparseWeights>(static_cast<const float*>(weightsNode->getMemoryPtr()->GetPtr()),
+                                                        weightsDims[0], weightsDims[1]);
+    }
+
     inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
     outDims = isDynamicNode() ? makeDummyOutputDims(inDims) : getOutputShapeAtPort(0).getStaticDims();
 
@@ -326,6 +340,9 @@ void FullyConnected::prepareParams() {
     };
     reshapeMemory(DNNL_ARG_SRC);
     reshapeMemory(DNNL_ARG_DST);
+
+    if (sparseWeights)
+        updateSparseRows(srcMemPtr->getStaticDims()[0]);
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
@@ -347,9 +364,17 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 
     setBatchPrimArgs(DNNL_ARG_SRC, getParentEdgesAtPort(0)[0]->getMemory().GetPrimitive());
     setBatchPrimArgs(DNNL_ARG_DST, getChildEdgesAtPort(0)[0]->getMemory().GetPrimitive());
+
+    if (sparseWeights)
+        updateSparseRows(batchToProcess());
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (sparseRows) {
+        executeSparse();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -377,9 +402,63 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the sparse weights product doesn't apply post ops
+    if (useSparseWeights)
+        return false;
+
     return canFuseSimpleOperation(node);
 }
 
+bool FullyConnected::isSparseWeightsApplicable() const {
+    // minSparseRate == 1 means that the sparse weights are switched off
+    if (minSparseRate == 1.f)
+        return false;
+
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 || getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        getInputShapeAtPort(WEIGHTS_ID).getRank() != 2)
+        return false;
+
+    const auto weightsNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!weightsNode || !weightsNode->isConstant())
+        return false;
+    const auto weightsMem = weightsNode->getMemoryPtr();
+    if (!weightsMem || weightsMem->getDesc().getPrecision() != Precision::FP32 ||
+        !weightsMem->getDesc().hasLayoutType(LayoutType::ncsp))
+        return false;
+
+    return SparseWeights::sparsity(static_cast<const float*>(weightsMem->GetPtr()),
+                                   weightsMem->getDesc().getShape().getElementsCount()) >= minSparseRate;
+}
+
+void FullyConnected::updateSparseRows(size_t batch) {
+    const auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    const auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t rows = srcDims.size() == 3 ? batch * srcDims[1] : batch;
+    const bool isPlanar = srcMemPtr->getDesc().hasLayoutType(LayoutType::ncsp) &&
+                          dstMemPtr->getDesc().hasLayoutType(LayoutType::ncsp);
+
+    // the dense primitive is used for the bigger inputs, it reuses each loaded weight for more rows
+    sparseRows = isPlanar && rows <= SparseWeights::MAX_ROWS_CHUNK ? rows : 0;
+    sparseScratch.resize(sparseWeights->scratchSize(sparseRows));
+}
+
+void FullyConnected::executeSparse() {
+    const auto *src = reinterpret_cast<const float *>(getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr()->GetPtr());
+    const float *bias = nullptr;
+    if (withBiases)
+        bias = reinterpret_cast<const float *>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr());
+    auto *dst = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    sparseWeights->execute(src, bias, dst, sparseRows, sparseScratch.data());
+}
+
+std::string FullyConnected::getPrimitiveDescriptorType() {
+    auto type = Node::getPrimitiveDescriptorType();
+    // only the shapes executed by the sparse product are reported as sparse
+    return sparseRows ? type + "_sparse" : type;
+}
+
 void FullyConnected::setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims, bool initWeights) {
     dnnl::post_ops ops;
 
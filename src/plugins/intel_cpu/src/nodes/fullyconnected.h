@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "common/sparse_weights.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -18,6 +19,7 @@ class FullyConnected : public Node {
 public:
     FullyConnected(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
 
+    void init() override;
     std::vector<dnnl::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
     void execute(dnnl::stream strm) override;
@@ -56,6 +58,12 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    std::string getPrimitiveDescriptorType() override;
+
+    void setSparseWeightsDecompressionRate(float rate) {
+        minSparseRate = rate;
+    }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -68,6 +76,10 @@ private:
 
     void setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims, bool initWeights = false);
 
+    bool isSparseWeightsApplicable() const;
+    void updateSparseRows(size_t batch);
+    void executeSparse();
+
     bool withBiases = false;
 
     std::string errorPrefix;
@@ -75,6 +87,15 @@ private:
     static const size_t WEIGHTS_ID = 1;
     static const size_t BIAS_ID = 2;
     dnnl::memory::data_type outputDataType;
+
+    // share of zero weights from which the weights are packed as sparse ones, 1 means that they are never packed
+    float minSparseRate = 1.f;
+    // the weights are checked once before the fusing, since they are scanned to compute the sparsity
+    bool useSparseWeights = false;
+    std::shared_ptr<SparseWeights> sparseWeights;
+    // number of the input rows if the current shape is executed with the sparse weights, 0 otherwise
+    size_t sparseRows = 0;
+    std::vector<float> sparseScratch;
 };
 
 }   // namespace node
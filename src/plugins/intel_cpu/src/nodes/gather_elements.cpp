@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -64,12 +65,10 @@ void GatherElements::prepareParams() {
     for (int i = dstDims.size() - 1; i > axis_; i--)
         strideAxDst_ *= dstDims[i];
     dstAxDim_ = dstDims[axis_];
-    if (axis_ > 0) {
-        strideAx1Diff_ = 1;
-        for (int i = dataDims.size() - 1; i >= axis_; i--)
-            strideAx1Diff_ *= dataDims[i];
-        strideAx1Diff_ -= strideAxDst_ * dstDims[axis_];
-    }
+    srcAxDim_ = dataDims[axis_];
+    outerSize_ = 1;
+    for (size_t i = 0; i < axis_; i++)
+        outerSize_ *= dstDims[i];
 }
 
 void GatherElements::initSupportedPrimitiveDescriptors() {
@@ -107,27 +106,34 @@ void GatherElements::directExecution() {
     const auto *indices = reinterpret_cast<const int *>(getParentEdgeAt(indicesIndex_)->getMemoryPtr()->GetPtr());
     auto *dstData = reinterpret_cast<dataType *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
-    const int outSize = getChildEdgesAtPort(0)[0]->getMemory().GetShape().getElementsCount();
+    const size_t outSize = outerSize_ * dstAxDim_ * strideAxDst_;
+    // The output is processed by runs of the elements sharing the input block, so the inner loops have
+    // no per element coordinate arithmetic and are vectorized as gathers.
     auto threadBody = [&](const int ithr, const int nthr) {
-        int start(0lu), end(0lu);
+        size_t start(0lu), end(0lu);
         splitter(outSize, nthr, ithr, start, end);
-        if (start >= end)
-            return;
 
-        int axStrideIt = start % strideAxDst_;
-        int dstAxIdx = (start / strideAxDst_) % dstAxDim_;
-        int dstShift0 = (start / strideAxDst_ / dstAxDim_) * strideAx1Diff_;
-
-        for (size_t o = start; o < end; o++, axStrideIt++) {
-            if (axStrideIt == strideAxDst_) {
-                axStrideIt = 0;
-                dstAxIdx++;
-                if (dstAxIdx == dstAxDim_) {
-                    dstAxIdx = 0;
-                    dstShift0 += strideAx1Diff_;
-                }
+        if (strideAxDst_ == 1) {
+            // the innermost axis: the output row o is gathered from the input row o
+            while (start < end) {
+                const size_t o = start / dstAxDim_;
+                const size_t runEnd = std::min(end, (o + 1) * dstAxDim_);
+                const dataType *srcRow = srcData + o * srcAxDim_;
+                for (size_t k = start; k < runEnd; k++)
+                    dstData[k] = srcRow[indices[k]];
+                start = runEnd;
             }
-            dstData[o] = srcData[o + dstShift0 + (indices[o] - dstAxIdx) * strideAxDst_];
+            return;
+        }
+
+        // the run of the output elements with the same outer and axis coordinates
+        while (start < end) {
+            const size_t row = start / strideAxDst_;
+            const size_t runEnd = std::min(end, (row + 1) * strideAxDst_);
+            const dataType *srcBlock = srcData + (row / dstAxDim_) * srcAxDim_ * strideAxDst_;
+            for (size_t k = start, i = start - row * strideAxDst_; k < runEnd; k++, i++)
+                dstData[k] = srcBlock[indices[k] * strideAxDst_ + i];
+            start = runEnd;
         }
     };
 
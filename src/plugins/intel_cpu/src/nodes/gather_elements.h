@@ -35,9 +35,10 @@ private:
 
     size_t axis_;
     size_t dataTypeSize_ = 0;
-    int strideAxDst_ = 0;
-    int dstAxDim_ = 0;
-    int strideAx1Diff_ = 0;
+    size_t strideAxDst_ = 0;
+    size_t dstAxDim_ = 0;
+    size_t srcAxDim_ = 0;
+    size_t outerSize_ = 0;
     std::string errorPrefix_;
 
     template <typename dataType>
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -167,21 +168,41 @@ void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const
         const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
         uint8_t* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
 
+        // The destination slices are consecutive, so the slices gathered from consecutive source slices
+        // (e.g. sorted or range indices) are merged into one copy.
+        const uint8_t* runSrc = nullptr;
+        uint8_t* runDst = shiftedDstData;
+        size_t runLength = 0lu;
+        auto flushRun = [&]() {
+            if (runLength)
+                cpu_memcpy(runDst, runSrc, runLength);
+        };
+
         for (size_t b = bStart; b < batchSize; b++) {
             for (size_t j = cStart; j < cycles; j++) {
                 size_t dataIdx = 0lu;
                 for (size_t i = 0; i < sliceRank; i++)
                     dataIdx += srcShifts[i] * shiftedIndices[i];
-                cpu_memcpy(shiftedDstData, &(shiftedSrcData[dataIdx]), dataLength);
+                const uint8_t* sliceSrc = shiftedSrcData + dataIdx;
+                if (runLength && runSrc + runLength == sliceSrc) {
+                    runLength += dataLength;
+                } else {
+                    flushRun();
+                    runSrc = sliceSrc;
+                    runDst = shiftedDstData;
+                    runLength = dataLength;
+                }
                 shiftedDstData += dataLength;
                 shiftedIndices += sliceRank;
                 if (++workCounter == end) {
+                    flushRun();
                     return;
                 }
             }
             cStart = 0;
             shiftedSrcData += srcBatchStride;
         }
+        flushRun();
     });
 }
 
@@ -204,18 +225,24 @@ void GatherND::GatherNDExecutor::gatherElementwise(const MemoryPtr& srcMemPtr, c
         const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
         dataType* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
 
-        for (size_t b = bStart; b < batchSize; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
-                size_t dataIdx = 0lu;
-                for (size_t i = 0lu; i < sliceRank; i++)
-                    dataIdx += srcShifts[i] * shiftedIndices[i];
-                shiftedDstData[0] = shiftedSrcData[dataIdx];
-                shiftedDstData++;
-                shiftedIndices += sliceRank;
-                if (++workCounter == end) {
-                    return;
+        for (size_t b = bStart; b < batchSize && workCounter < end; b++) {
+            // the elements of the batch handled by this thread, the loops over them are vectorized as gathers
+            const size_t count = std::min(cycles - cStart, end - workCounter);
+            if (sliceRank == 1lu) {
+                const size_t shift = srcShifts[0];
+                for (size_t j = 0lu; j < count; j++)
+                    shiftedDstData[j] = shiftedSrcData[shift * shiftedIndices[j]];
+            } else {
+                for (size_t j = 0lu; j < count; j++) {
+                    size_t dataIdx = 0lu;
+                    for (size_t i = 0lu; i < sliceRank; i++)
+                        dataIdx += srcShifts[i] * shiftedIndices[j * sliceRank + i];
+                    shiftedDstData[j] = shiftedSrcData[dataIdx];
                 }
             }
+            shiftedDstData += count;
+            shiftedIndices += count * sliceRank;
+            workCounter += count;
             cStart = 0lu;
             shiftedSrcData += srcBatchStride;
         }
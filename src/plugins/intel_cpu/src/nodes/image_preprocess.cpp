@@ -0,0 +1,233 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+#include "image_preprocess.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+
+template <typename T>
+inline float clipColor(float value) {
+    value = std::min(std::max(value, 0.f), 255.f);
+    return std::is_integral<T>::value ? std::round(value) : value;
+}
+
+// Same coefficients as the reference NV12/I420 conversions and the ColorConvert node
+template <typename T>
+inline void yuvToRgb(float y, float u, float v, float* rgb) {
+    const float c = y - 16.f;
+    const float d = u - 128.f;
+    const float e = v - 128.f;
+    rgb[0] = clipColor<T>(1.164f * c + 1.596f * e);
+    rgb[1] = clipColor<T>(1.164f * c - 0.391f * d - 0.813f * e);
+    rgb[2] = clipColor<T>(1.164f * c + 2.018f * d);
+}
+
+// Source row of a YUV image: U and V samples of pixel x are at u[(x / 2) * step] and v[(x / 2) * step]
+template <typename T>
+struct YUVRow {
+    const T* y;
+    const T* u;
+    const T* v;
+    size_t step;
+
+    inline void rgb(size_t x, float* out) const {
+        const size_t uvIdx = (x / 2) * step;
+        yuvToRgb<T>(static_cast<float>(y[x]), static_cast<float>(u[uvIdx]), static_cast<float>(v[uvIdx]), out);
+    }
+};
+
+// Source coordinate for the half_pixel transformation, as Interpolate-4 computes it in 'sizes' mode
+inline float sourceCoord(size_t dst, size_t srcLen, size_t dstLen) {
+    const float scale = static_cast<float>(dstLen) / static_cast<float>(srcLen);
+    return (static_cast<float>(dst) + 0.5f) / scale - 0.5f;
+}
+
+void initLinearTaps(size_t srcLen, size_t dstLen, std::vector<size_t>& idx0, std::vector<size_t>& idx1, std::vector<float>& weight) {
+    idx0.resize(dstLen);
+    idx1.resize(dstLen);
+    weight.resize(dstLen);
+    const auto clampIdx = [srcLen](int64_t i) {
+        return static_cast<size_t>(std::min<int64_t>(std::max<int64_t>(i, 0), srcLen - 1));
+    };
+    for (size_t i = 0; i < dstLen; i++) {
+        const float src = sourceCoord(i, srcLen, dstLen);
+        const float base = std::floor(src);
+        idx0[i] = clampIdx(static_cast<int64_t>(base));
+        idx1[i] = clampIdx(static_cast<int64_t>(base) + 1);
+        weight[i] = idx0[i] == idx1[i] ? 0.f : src - base;
+    }
+}
+
+void initNearestTaps(size_t srcLen, size_t dstLen, std::vector<size_t>& idx) {
+    idx.resize(dstLen);
+    for (size_t i = 0; i < dstLen; i++) {
+        const float src = sourceCoord(i, srcLen, dstLen);
+        // round_prefer_floor
+        const float rounded = src == std::floor(src) + 0.5f ? std::floor(src) : std::round(src);
+        idx[i] = static_cast<size_t>(std::min<int64_t>(std::max<int64_t>(static_cast<int64_t>(rounded), 0), srcLen - 1));
+    }
+}
+
+}   // namespace
+
+bool ImagePreprocess::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto preprocess = std::dynamic_pointer_cast<const ImagePreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only ImagePreprocess operation from cpu_plugin_opset is supported";
+            return false;
+        }
+        if (op->is_dynamic()) {
+            errorMessage = "Only static shapes are supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+ImagePreprocess::ImagePreprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng,
+                                 WeightsSharing::Ptr &cache) : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ImagePreprocess layer with name '" + op->get_friendly_name() + "' ";
+    attrs = std::dynamic_pointer_cast<const ImagePreprocessNode>(op)->get_attrs();
+}
+
+void ImagePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    inputPrecision = getOriginalInputPrecisionAtPort(0);
+    if (inputPrecision != Precision::U8 && inputPrecision != Precision::FP32)
+        inputPrecision = Precision::FP32;
+
+    std::vector<PortConfigurator> inPortConfigs(getOriginalInputsNumber(), {LayoutType::ncsp, inputPrecision});
+    addSupportedPrimDesc(inPortConfigs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+void ImagePreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    if (srcDims.size() != 4 || dstDims.size() != 4)
+        IE_THROW() << errorPrefix << "has unexpected rank of input or output";
+
+    batch = srcDims[0];
+    srcHeight = getOriginalInputsNumber() == 1 ? srcDims[1] * 2 / 3 : srcDims[1];
+    srcWidth = srcDims[2];
+    dstHeight = attrs.planar ? dstDims[2] : dstDims[1];
+    dstWidth = attrs.planar ? dstDims[3] : dstDims[2];
+
+    if (attrs.linear) {
+        initLinearTaps(srcHeight, dstHeight, rowIdx0, rowIdx1, rowWeight);
+        initLinearTaps(srcWidth, dstWidth, colIdx0, colIdx1, colWeight);
+    } else {
+        initNearestTaps(srcHeight, dstHeight, rowIdx0);
+        initNearestTaps(srcWidth, dstWidth, colIdx0);
+        rowIdx1 = rowIdx0;
+        colIdx1 = colIdx0;
+        rowWeight.assign(dstHeight, 0.f);
+        colWeight.assign(dstWidth, 0.f);
+    }
+}
+
+template <typename T>
+void ImagePreprocess::preprocess() {
+    const size_t planeSize = srcHeight * srcWidth;
+    const bool singlePlane = getOriginalInputsNumber() == 1;
+
+    const T* yPlane = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const T* uPlane = nullptr;
+    const T* vPlane = nullptr;
+    size_t strideY = planeSize;
+    size_t strideUV = attrs.i420 ? planeSize / 4 : planeSize / 2;
+    if (singlePlane) {
+        strideY = strideUV = planeSize * 3 / 2;
+        uPlane = yPlane + planeSize;
+        vPlane = attrs.i420 ? yPlane + planeSize * 5 / 4 : uPlane + 1;
+    } else {
+        uPlane = reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+        vPlane = attrs.i420 ? reinterpret_cast<const T*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr()) : uPlane + 1;
+    }
+    float* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t uvRowStride = attrs.i420 ? srcWidth / 2 : srcWidth;
+    const size_t uvStep = attrs.i420 ? 1 : 2;
+    const size_t dstPlane = dstHeight * dstWidth;
+    const bool resize = attrs.linear && (srcHeight != dstHeight || srcWidth != dstWidth);
+    // output channel c takes color rgb[order[c]]
+    const size_t order[3] = {attrs.bgr ? 2u : 0u, 1u, attrs.bgr ? 0u : 2u};
+    const float* scale = attrs.scale.data();
+    const float* shift = attrs.shift.data();
+
+    parallel_for2d(batch, dstHeight, [&](size_t b, size_t oy) {
+        const auto sourceRow = [&](size_t sy) {
+            const size_t uvOffset = b * strideUV + (sy / 2) * uvRowStride;
+            return YUVRow<T>{yPlane + b * strideY + sy * srcWidth, uPlane + uvOffset, vPlane + uvOffset, uvStep};
+        };
+        const YUVRow<T> row0 = sourceRow(rowIdx0[oy]);
+        const YUVRow<T> row1 = sourceRow(rowIdx1[oy]);
+        const float wy = rowWeight[oy];
+
+        float* dstRow = attrs.planar ? dst + b * 3 * dstPlane + oy * dstWidth
+                                     : dst + (b * dstPlane + oy * dstWidth) * 3;
+        const size_t channelStride = attrs.planar ? dstPlane : 1;
+        const size_t pixelStride = attrs.planar ? 1 : 3;
+
+        for (size_t ox = 0; ox < dstWidth; ox++) {
+            float rgb[3];
+            row0.rgb(colIdx0[ox], rgb);
+            if (resize) {
+                float p01[3], p10[3], p11[3];
+                row0.rgb(colIdx1[ox], p01);
+                row1.rgb(colIdx0[ox], p10);
+                row1.rgb(colIdx1[ox], p11);
+                const float wx = colWeight[ox];
+                for (size_t c = 0; c < 3; c++) {
+                    const float top = rgb[c] + (p01[c] - rgb[c]) * wx;
+                    const float bottom = p10[c] + (p11[c] - p10[c]) * wx;
+                    rgb[c] = top + (bottom - top) * wy;
+                    if (attrs.round_resized)
+                        rgb[c] = std::min(std::max(std::round(rgb[c]), 0.f), 255.f);
+                }
+            }
+            float* out = dstRow + ox * pixelStride;
+            for (size_t c = 0; c < 3; c++)
+                out[c * channelStride] = rgb[order[c]] * scale[c] + shift[c];
+        }
+    });
+}
+
+void ImagePreprocess::execute(dnnl::stream strm) {
+    if (inputPrecision == Precision::U8) {
+        preprocess<uint8_t>();
+    } else {
+        preprocess<float>();
+    }
+}
+
+bool ImagePreprocess::created() const {
+    return getType() == Type::ImagePreprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include "ngraph_transformations/op/image_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * Executes the fused NV12/I420 -> resize -> normalize -> layout chain (see FuseImagePreprocess) in a single pass:
+ * every output pixel converts only the source pixels its resize taps read, so the full-resolution RGB image and
+ * the intermediate tensors of the unfused chain are never materialized.
+ */
+class ImagePreprocess : public Node {
+public:
+    ImagePreprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+
+    void prepareParams() override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T>
+    void preprocess();
+
+    ImagePreprocessNode::Attributes attrs;
+    InferenceEngine::Precision inputPrecision;
+
+    size_t batch = 0;
+    size_t srcHeight = 0;
+    size_t srcWidth = 0;
+    size_t dstHeight = 0;
+    size_t dstWidth = 0;
+
+    // resize taps: source indices and the weight of the second tap (linear) per output row / column
+    std::vector<size_t> rowIdx0, rowIdx1, colIdx0, colIdx1;
+    std::vector<float> rowWeight, colWeight;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -1566,7 +1566,9 @@ Interpolate::Interpolate(const std::shared_ptr<ngraph::Node>& op, const dnnl::en
         if (interpMode == ngInterpMode::nearest) {
             interpAttrs.mode = InterpolateMode::nearest;
         } else if (interpMode == ngInterpMode::linear) {
-            if (dataRank < 5) {
+            // linear_onnx is the same as linear without antialias, so the antialiased 4D case goes
+            // to the separable linear filter too. Antialias is not applied for the ranks below 4.
+            if (dataRank < 5 && !(dataRank == 4 && interpAttr.antialias)) {
                 interpAttrs.mode = InterpolateMode::linear_onnx;
             } else {
                 interpAttrs.mode = InterpolateMode::linear;
@@ -1752,7 +1754,15 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
     const auto &dataMinDims = getInputShapeAtPort(DATA_ID).getMinDims();
     bool isBlkApplied = getInputShapeAtPort(DATA_ID).getRank() > 1 && dataMinDims[1] != Shape::UNDEFINED_DIM && dataMinDims[1] > 1;
 
-    if (!mayiuse(cpu::x64::sse41) || interpAttrs.mode == InterpolateMode::linear) {
+    if (!mayiuse(cpu::x64::sse41)) {
+        pushDesc(LayoutType::ncsp, ref);
+    } else if (interpAttrs.mode == InterpolateMode::linear) {
+        // separable reference filter, by_channel and blk layouts make the channels its innermost contiguous dimension
+        if (getInputShapeAtPort(DATA_ID).getRank() == 4 || getInputShapeAtPort(DATA_ID).getRank() == 5) {
+            pushDesc(LayoutType::nspc, ref);
+            if (isBlkApplied)
+                pushDesc(mayiuse(cpu::x64::avx512_core) ? LayoutType::nCsp16c : LayoutType::nCsp8c, ref);
+        }
         pushDesc(LayoutType::ncsp, ref);
     } else {
         // blk and by_channel JIT kernel on sse41 or above machine
@@ -1888,7 +1898,8 @@ void Interpolate::prepareParams() {
             executor = std::make_shared<InterpolateRefExecutor>(key.nodeAttrs,
                                                                key.srcDims,
                                                                key.dstDims,
-                                                               key.dataScales);
+                                                               key.dataScales,
+                                                               key.attr);
         }
         return executor;
     };
@@ -1935,6 +1946,52 @@ static inline float triangleCoeff(float x) {
     return (std::max)(0.0f, 1 - std::abs(x));
 }
 
+// divides the dia weights of every output coordinate by their sum, all weights stay zero if the sum is zero
+static void normalizeLinearWeights(float *weights, int len, int dia) {
+    for (int o = 0; o < len; o++) {
+        float *w = weights + o * dia;
+        float wsum = 0.f;
+        for (int i = 0; i < dia; i++)
+            wsum += w[i];
+        if (wsum == 0.f)
+            continue;
+        for (int i = 0; i < dia; i++)
+            w[i] /= wsum;
+    }
+}
+
+// the axis is copied as is if every output coordinate takes the input one with the same index
+static bool isIdentityLinearAxis(const int *indices, const float *weights, int inLen, int outLen, int dia) {
+    if (inLen != outLen)
+        return false;
+    for (int o = 0; o < outLen; o++) {
+        for (int i = 0; i < dia; i++) {
+            const float expected = indices[o * dia + i] == o ? 1.f : 0.f;
+            if (weights[o * dia + i] != expected)
+                return false;
+        }
+    }
+    return true;
+}
+
+// one pass of the separable linear filter over the [outer, len, rowSize] tensor:
+// dst[o, j, :] = sum(weights[j * dia + t] * src[o, indices[j * dia + t], :])
+static void linearFilterAxis(const float *src, float *dst, size_t outer, size_t inLen, size_t outLen, size_t rowSize,
+                             const int *indices, const float *weights, int dia) {
+    parallel_for2d(outer, outLen, [&](size_t o, size_t j) {
+        float *dstRow = dst + (o * outLen + j) * rowSize;
+        std::fill(dstRow, dstRow + rowSize, 0.f);
+        for (int t = 0; t < dia; t++) {
+            const float w = weights[j * dia + t];
+            if (w == 0.f)
+                continue;
+            const float *srcRow = src + (o * inLen + indices[j * dia + t]) * rowSize;
+            for (size_t i = 0; i < rowSize; i++)
+                dstRow[i] += w * srcRow[i];
+        }
+    });
+}
+
 void Interpolate::setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims) {
     dnnl::post_ops ops;
 
@@ -2583,6 +2640,8 @@ void Interpolate::InterpolateExecutor::buildTblLinear(const SizeVector& srcDimPa
     float fx = dataScales[dimSize - 1];
     size_t ID = srcDimPad5d[2], IH = srcDimPad5d[3], IW = srcDimPad5d[4];
     size_t OD = dstDim5d[2], OH = dstDim5d[3], OW = dstDim5d[4];
+    // the window is widened only if any axis is downsampled, as in exec()
+    antialias = antialias && (fx < 1.f || fy < 1.f || fz < 1.f);
 
     if (!(IW == OW && IH == OH && ID == OD)) {
         float ax = antialias ? fx : 1.0f;
@@ -2649,6 +2708,12 @@ void Interpolate::InterpolateExecutor::buildTblLinear(const SizeVector& srcDimPa
                 }
             }
         }
+
+        // the 3D window weight is the product of the axes ones, so normalizing every axis separately
+        // is the same as dividing the window sum by the window weight
+        normalizeLinearWeights(weightOD, OD, diaOD);
+        normalizeLinearWeights(weightOH, OH, diaOH);
+        normalizeLinearWeights(weightOW, OW, diaOW);
     }
 }
 
@@ -2941,22 +3006,47 @@ void Interpolate::InterpolateRefExecutor::setValue(uint8_t *base, size_t offset,
     }
 }
 
-void Interpolate::InterpolateRefExecutor::linearInterpolation(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW,
+void Interpolate::InterpolateRefExecutor::linearInterpolation(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_,
+                                          int B, int C, int ID, int IH, int IW,
                                           float fx, float fy, float fz, int OD, int OH, int OW, int kernel_width, bool antialias) {
+    // the tensor is processed as [outer, D, H, W, inner], channels are the innermost dimension in by_channel and block layouts
+    size_t outer = B * C, inner = 1;
+    if (configured_for_layout == InterpolateLayoutType::by_channel) {
+        outer = B;
+        inner = C;
+    } else if (configured_for_layout == InterpolateLayoutType::block) {
+        size_t blkSize = mayiuse(cpu::x64::avx512_core) ? 16 : 8;
+        outer = B * div_up(C, blkSize);
+        inner = blkSize;
+    }
+
+    // the fused post ops are applied in the final fp32 -> output precision conversion
+    const bool withPostOps = attr.get()->post_ops_.len() != 0;
+    const size_t spatial = static_cast<size_t>(OD) * OH * OW;
+    auto storeValue = [&](size_t i, float value) {
+        if (withPostOps) {
+            size_t c = 0;
+            if (configured_for_layout == InterpolateLayoutType::by_channel) {
+                c = i % inner;
+            } else if (configured_for_layout == InterpolateLayoutType::block) {
+                c = (i / (spatial * inner)) % (outer / B) * inner + i % inner;
+            } else {
+                c = (i / spatial) % C;
+            }
+            // the tail of the last channels block is padding
+            if (c < static_cast<size_t>(C))
+                applyPostOpsScalar(value, static_cast<int>(c), post_ops_data_);
+        }
+        setValue(out_ptr_, i * dstDataSize, value, outputPrec);
+    };
+
     if (IW == OW && IH == OH && ID == OD) {
-        size_t spatialDimSize = IW * IH * ID;
-        // TODO: enable when fusing into interp with linear mode will support
-        if (/*fusedWith.empty() &&*/ inputPrec == outputPrec) {
-            size_t size = B * C * spatialDimSize * srcDataSize;
-            cpu_memcpy(out_ptr_, in_ptr_, size);
+        size_t eltsTotal = outer * ID * IH * IW * inner;
+        if (!withPostOps && inputPrec == outputPrec) {
+            cpu_memcpy(out_ptr_, in_ptr_, eltsTotal * srcDataSize);
         } else {
-            parallel_for2d(B, C, [&](size_t b, size_t c) {
-                const uint8_t *in_ptr_nc = in_ptr_ + (spatialDimSize * C * b + spatialDimSize * c) * srcDataSize;
-                uint8_t *out_ptr_nc = out_ptr_ + (spatialDimSize * C * b + spatialDimSize * c) * dstDataSize;
-                for (size_t i = 0; i < spatialDimSize; i++) {
-                    float dstValue = getValue(in_ptr_nc, i * srcDataSize, inputPrec);
-                    setValue(out_ptr_nc, i * dstDataSize, dstValue, outputPrec);
-                }
+            parallel_for(eltsTotal, [&](size_t i) {
+                storeValue(i, getValue(in_ptr_, i * srcDataSize, inputPrec));
             });
         }
         return;
@@ -2987,75 +3077,103 @@ void Interpolate::InterpolateRefExecutor::linearInterpolation(const uint8_t *in_
     int *idxOH = static_cast<int*>(&idxTable[sizeOD]);
     int *idxOW = static_cast<int*>(&idxTable[sizeOD + sizeOH]);
 
-    parallel_for2d(B, C, [&](size_t b, size_t c) {
-        const uint8_t *in_ptr_nc = in_ptr_ + (IW * IH * ID * C * b + IW * IH * ID * c) * srcDataSize;
-        uint8_t *out_ptr_nc = out_ptr_ + (OW * OH * OD * C * b + OW * OH * OD * c) * dstDataSize;
-        for (size_t oz = 0; oz < OD; oz++) {
-            uint8_t *out_ptr_ncd = out_ptr_nc + (OW * OH * oz) * dstDataSize;
-            for (size_t oy = 0; oy < OH; oy++) {
-                uint8_t *out_ptr_ncdh = out_ptr_ncd + (OW * oy) * dstDataSize;
-                for (size_t ox = 0; ox < OW; ox++) {
-                    float sum = 0.f;
-                    float wsum = 0.f;
-
-                    // this comment explains the original algo.
-                    // for (int z = iz_r - rz; z <= iz_r + rz; z++) {
-                    //    for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                    //        for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                    //            bool is_continue =  z < 0                     ||
-                    //                                y < 0                     ||
-                    //                                x < 0                     ||
-                    //                                z >= static_cast<int>(ID) ||
-                    //                                y >= static_cast<int>(IH) ||
-                    //                                x >= static_cast<int>(IW);
-                    //            if (is_continue)
-                    //                continue;
-
-                    //            float dx = ix - x;
-                    //            float dy = iy - y;
-                    //            float dz = iz - z;
-
-                    //            float w = ax * triangleCoeff(ax * dx) *
-                    //                      ay * triangleCoeff(ay * dy) *
-                    //                      az * triangleCoeff(az * dz);
-
-                    //            sum += w * getValue(in_ptr_nc, (z * IH * IW + y * IW + x) * srcDataSize, inputPrec);
-                    //            wsum += w;
-                    //        }
-                    //    }
-                    //}
-
-                    for (int iz = 0; iz < diaOD; iz++) {
-                        if (weightOD[oz * diaOD + iz] == 0.f)
-                            continue;
-                        for (int iy = 0; iy < diaOH; iy++) {
-                            if (weightOH[oy * diaOH + iy] == 0.f) {
-                                continue;
-                            }
-                            for (int ix = 0; ix < diaOW; ix++) {
-                                if (weightOW[ox * diaOW + ix] == 0.f) {
-                                    continue;
-                                }
-                                float w = weightOD[oz * diaOD + iz] * weightOH[oy * diaOH + iy] * weightOW[ox * diaOW + ix];
-                                float value = getValue(in_ptr_nc,
-                                    (idxOD[oz * diaOD + iz] * IH * IW + idxOH[oy * diaOH + iy] * IW + idxOW[ox * diaOW + ix]) * srcDataSize, inputPrec);
-
-                                sum += w * value;
-                                wsum += w;
-                            }
-                        }
-                    }
+    // The 3D window weight is the product of the normalized axes weights, so the window is applied as
+    // separable 1D passes along W, H and D, each one is a weighted sum of contiguous rows vectorized by the compiler.
+    // The axes are filtered in place of each other, so the dimensions of the skipped (identity) axes are the same.
+    struct Pass {
+        size_t outer, inLen, outLen, rowSize;
+        const int *indices;
+        const float *weights;
+        int dia;
+    };
+    std::vector<Pass> passes;
+    if (!isIdentityLinearAxis(idxOW, weightOW, IW, OW, diaOW))
+        passes.push_back({outer * ID * IH, static_cast<size_t>(IW), static_cast<size_t>(OW), inner, idxOW, weightOW, diaOW});
+    if (!isIdentityLinearAxis(idxOH, weightOH, IH, OH, diaOH))
+        passes.push_back({outer * ID, static_cast<size_t>(IH), static_cast<size_t>(OH), OW * inner, idxOH, weightOH, diaOH});
+    if (!isIdentityLinearAxis(idxOD, weightOD, ID, OD, diaOD))
+        passes.push_back({outer, static_cast<size_t>(ID), static_cast<size_t>(OD), OH * OW * inner, idxOD, weightOD, diaOD});
+
+    const float *src = reinterpret_cast<const float *>(in_ptr_);
+    if (inputPrec != Precision::FP32) {
+        linearSrcBuffer.resize(outer * ID * IH * IW * inner);
+        parallel_for(linearSrcBuffer.size(), [&](size_t i) {
+            linearSrcBuffer[i] = getValue(in_ptr_, i * srcDataSize, inputPrec);
+        });
+        src = linearSrcBuffer.data();
+    }
+
+    // the shapes of the executor are fixed, so the buffers are allocated on the first inference only
+    for (size_t p = 0; p < passes.size(); p++) {
+        const auto &pass = passes[p];
+        float *dst = nullptr;
+        if (p + 1 == passes.size() && outputPrec == Precision::FP32 && !withPostOps) {
+            dst = reinterpret_cast<float *>(out_ptr_);
+        } else {
+            linearPassBuffers[p % 2].resize(pass.outer * pass.outLen * pass.rowSize);
+            dst = linearPassBuffers[p % 2].data();
+        }
+        linearFilterAxis(src, dst, pass.outer, pass.inLen, pass.outLen, pass.rowSize, pass.indices, pass.weights, pass.dia);
+        src = dst;
+    }
 
-                    if (!wsum) {
-                        setValue(out_ptr_ncdh, ox * dstDataSize, 0.f, outputPrec);
-                    } else {
-                        float dst_value = sum / wsum;
-                        setValue(out_ptr_ncdh, ox * dstDataSize, dst_value, outputPrec);
-                    }
-                }
-            }
+    if (outputPrec != Precision::FP32 || withPostOps) {
+        parallel_for(outer * spatial * inner, [&](size_t i) {
+            storeValue(i, src[i]);
+        });
+    }
+}
+
+void Interpolate::InterpolateRefExecutor::applyPostOpsScalar(float &dstValue, int channel, const void *post_ops_data_) const {
+    const auto &p = attr.get()->post_ops_;
+    int eltwiseInjIdx = 0;
+    int depthwiseInjIdx = 0;
+    // post_ops_data_ is the array of the post ops data pointers in the order of the post ops
+    auto postOpsData = reinterpret_cast<const float* const*>(post_ops_data_);
+    for (int i = 0; i < p.len(); i++) {
+        auto &postOp = p.entry_[i];
+        if (postOp.is_eltwise()) {
+            dstValue = eltwiseInjectorsRef[eltwiseInjIdx]->compute_scalar(dstValue);
+            eltwiseInjIdx++;
+        } else if (postOp.is_depthwise()) {
+            auto depthwiseBase = *postOpsData;
+            auto depthwiseWeights = depthwiseBase + postOp.depthwise.offset[postOp.depthwise.scales] + channel;
+            auto depthwiseBias = depthwiseBase + postOp.depthwise.offset[postOp.depthwise.shifts] + channel;
+
+            dstValue = depthwiseInjectorsRef[depthwiseInjIdx]->compute_scalar(dstValue, depthwiseWeights, depthwiseBias);
+
+            depthwiseInjIdx++;
+            postOpsData++;
+        } else if (postOp.is_quantization()) {
+            bool doDequantization = postOp.quantization.alg == alg_kind::quantization_quantize_dequantize;
+            auto quant = postOp.quantization;
+
+            using quantization_fields = post_ops_t::entry_t::quantization_t::quantization_fields;
+            auto dataVal = [&](const quantization_fields& field) -> float {
+                auto dataPtr = *postOpsData + quant.offset[field];
+                const int channelIdx = quant.per_channel[field] ? channel : 0;
+                return dataPtr[channelIdx];
+            };
+
+            float cropLow = dataVal(quant.crop_low);
+            float cropHigh = dataVal(quant.crop_high);
+            float inputScale = dataVal(quant.inp_scale);
+            float inputShift = dataVal(quant.inp_shift);
+
+            dstValue = nstl::min(cropHigh, nstl::max(cropLow, dstValue));
+            dstValue = dstValue * inputScale + inputShift;
+            // setValue truncates, so the quantized value is always rounded here
+            dstValue = roundf(dstValue);
+
+            if (doDequantization) {
+                float outputScale = dataVal(quant.output_scale);
+                float outputShift = dataVal(quant.output_shift);
+                dstValue = dstValue * outputScale + outputShift;
+            }
+
+            postOpsData++;
         }
-    });
+    }
 }
 
 Interpolate::InterpolateExecutor::InterpolateExecutor(const InterpolateAttrs& interpAttrs,
@@ -3139,6 +3257,24 @@ Interpolate::InterpolateJitExecutor::InterpolateJitExecutor(const InterpolateAtt
     }
 }
 
+Interpolate::InterpolateRefExecutor::InterpolateRefExecutor(const InterpolateAttrs& interpAttrs,
+                                                            const VectorDims &srcDims,
+                                                            const VectorDims &dstDims,
+                                                            const std::vector<float> &_dataScales,
+                                                            const dnnl::primitive_attr &_attr) :
+        InterpolateExecutor(interpAttrs, srcDims, dstDims, _dataScales), antialias(interpAttrs.antialias), dataScales(_dataScales), attr(_attr) {
+    const auto &p = attr.get()->post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        auto &postOp = p.entry_[i];
+        if (postOp.is_eltwise()) {
+            eltwiseInjectorsRef.push_back(std::make_shared<ref_eltwise_scalar_fwd_t>(
+                    postOp.eltwise.alg, postOp.eltwise.alpha, postOp.eltwise.beta, postOp.eltwise.scale));
+        } else if (postOp.is_depthwise()) {
+            depthwiseInjectorsRef.push_back(std::make_shared<ref_depthwise_scalar_fwd_t>(postOp.depthwise.alg));
+        }
+    }
+}
+
 void Interpolate::InterpolateJitExecutor::exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) {
     size_t N = srcDimPad5d[0], C = srcDimPad5d[1], ID = srcDimPad5d[2], IH = srcDimPad5d[3], IW = srcDimPad5d[4];
     size_t OD = dstDim5d[2], OH = dstDim5d[3], OW = dstDim5d[4];
@@ -3201,7 +3337,8 @@ void Interpolate::InterpolateRefExecutor::exec(const uint8_t *in_ptr_, uint8_t *
 
             bool isDownsample = (fx < 1.f) || (fy < 1.f) || (fz < 1.f);
             int kernel_width = 2;
-            linearInterpolation(in_ptr_, out_ptr_, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW, kernel_width, isDownsample && antialias);
+            linearInterpolation(in_ptr_, out_ptr_, post_ops_data_, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW, kernel_width,
+                                isDownsample && antialias);
             break;
         }
         default: {
@@ -3226,7 +3363,7 @@ size_t Interpolate::getSpatialDimsNum(const Dim rank) {
 }
 
 bool Interpolate::canFuse(const NodePtr& node) const {
-    if (!mayiuse(cpu::x64::sse41) || interpAttrs.mode == InterpolateMode::linear) {
+    if (!mayiuse(cpu::x64::sse41)) {
         return false;
     }
 
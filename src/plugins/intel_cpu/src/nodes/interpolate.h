@@ -9,6 +9,8 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cpu/ref_eltwise.hpp>
+#include <cpu/ref_depthwise_injector.hpp>
 
 #define MAX_INPUT_INTERPOLATE 8
 
@@ -208,8 +210,8 @@ private:
             InterpolateRefExecutor(const InterpolateAttrs& interpAttrs,
                                    const VectorDims &srcDims,
                                    const VectorDims &dstDims,
-                                   const std::vector<float> &_dataScales) : dataScales(_dataScales), antialias(interpAttrs.antialias),
-                InterpolateExecutor(interpAttrs, srcDims, dstDims, _dataScales) {}
+                                   const std::vector<float> &_dataScales,
+                                   const dnnl::primitive_attr &_attr);
 
             void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
 
@@ -218,15 +220,25 @@ private:
             void linearOnnxRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW, int OD, int OH, int OW);
 
             void cubicRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int IH, int IW, int OH, int OW);
-            void linearInterpolation(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW,
+            void linearInterpolation(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, int B, int C, int ID, int IH, int IW,
                                       float fx, float fy, float fz, int OD, int OH, int OW, int kernel_width, bool antialias);
 
+            void applyPostOpsScalar(float &dstValue, int channel, const void *post_ops_data_) const;
+
             static float getValue(const uint8_t *base, size_t offset, InferenceEngine::Precision prec);
             static void setValue(uint8_t *base, size_t offset, float value, InferenceEngine::Precision prec);
 
         private:
             bool antialias;
             std::vector<float> dataScales;
+            // fp32 copy of the not fp32 input and the intermediate results of the linear mode passes,
+            // kept between the inferences
+            std::vector<float> linearSrcBuffer;
+            std::vector<float> linearPassBuffers[2];
+
+            dnnl::primitive_attr attr;
+            std::vector<std::shared_ptr<dnnl::impl::cpu::ref_eltwise_scalar_fwd_t>> eltwiseInjectorsRef;
+            std::vector<std::shared_ptr<dnnl::impl::cpu::ref_depthwise_scalar_fwd_t>> depthwiseInjectorsRef;
     };
 
     void setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims);
@@ -13,6 +13,7 @@
 #include "ie_parallel.hpp"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_utils.h"
 
 using namespace InferenceEngine;
 
@@ -147,34 +148,13 @@ static inline float boxArea(const float* bbox, const bool normalized) {
         }
     }
 }
-
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
     std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
+    int64_t originalSize = filterByScore(scoresData, m_numBoxes, m_scoreThreshold, false, candidateIndex.data());
+    auto end = candidateIndex.begin() + originalSize;
     if (originalSize <= 0) {
         return 0;
     }
@@ -189,16 +169,23 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
+    std::vector<float> areas(originalSize);
+    NmsBoxes candidates(NmsBoxes::Overlap::Touching, m_normalized ? 0.f : 1.f);
+    candidates.reserve(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        auto box = boxesData + candidateIndex[i] * 4;
+        areas[i] = boxArea(box, m_normalized);
+        candidates.push_back(box, areas[i]);
+    }
+
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
         float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
+        float* iou = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        candidates.iou(boxesData + candidateIndex[actual_index] * 4, areas[actual_index], actual_index, iou);
+        for (size_t j = 0; j < actual_index; j++) {
+            max_iou = std::max(max_iou, iou[j]);
         }
         iouMax[actual_index] = max_iou;
     });
@@ -10,13 +10,13 @@
 #include <chrono>
 #include <cmath>
 #include <ie_ngraph_utils.hpp>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_utils.h"
 
 using namespace InferenceEngine;
 
@@ -26,6 +26,16 @@ namespace node {
 
 using ngNmsSortResultType = ov::op::util::MulticlassNmsBase::SortResultType;
 
+namespace {
+
+// boxes are [ymin, xmin, ymax, xmax], to align with reference
+inline float boxArea(const float* box, const bool normalized) {
+    const float norm = static_cast<float>(normalized == false);
+    return (box[2] - box[0] + norm) * (box[3] - box[1] + norm);
+}
+
+}  // namespace
+
 bool MultiClassNms::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(),
@@ -387,30 +397,6 @@ bool MultiClassNms::created() const {
     return getType() == Type::MulticlassNms;
 }
 
-float MultiClassNms::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
-}
-
 void MultiClassNms::nmsWithEta(const float* boxes,
                                 const float* scores,
                                 const int* roisnum,
@@ -418,14 +404,6 @@ void MultiClassNms::nmsWithEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
-    auto less = [](const boxInfo& l, const boxInfo& r) {
-        return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
-    };
-
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0f : 0.0f;
-    };
-
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (!shared) {
             if (roisnum[batch_idx] <= 0) {
@@ -434,58 +412,35 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             }
         }
         if (class_idx != m_backgroundClass) {
-            std::vector<filteredBoxes> fb;
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
-            fb.reserve(sorted_boxes.size());
-            if (sorted_boxes.size() > 0) {
-                auto adaptive_threshold = m_iouThreshold;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                while (max_out_box && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
-                    sorted_boxes.pop();
-                    max_out_box--;
-
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
-                    }
+            std::vector<int> candidates(cur_numBoxes);
+            size_t candidatesNum = filterByScore(scoresPtr, cur_numBoxes, m_scoreThreshold, true, candidates.data());  // align with ref
+            size_t max_out_box = topKByScore(candidates.data(), candidatesNum, m_nmsRealTopk, scoresPtr);
 
-                    currBox.suppress_begin_index = fb.size();
-                    if (box_is_selected) {
-                        if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
-                            adaptive_threshold *= m_nmsEta;
-                        }
-                        if (currBox.score == origScore) {
-                            fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
-                    }
-                }
-            }
-            m_numFiltBox[batch_idx][class_idx] = fb.size();
+            NmsBoxes selected(NmsBoxes::Overlap::Positive, m_normalized ? 0.f : 1.f);
+            selected.reserve(max_out_box);
             size_t offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-            for (size_t i = 0; i < fb.size(); i++) {
-                m_filtBoxes[offset + i] = fb[i];
+            auto adaptive_threshold = m_iouThreshold;
+            for (size_t i = 0; i < max_out_box; i++) {
+                const int box_idx = candidates[i];
+                const float score = scoresPtr[box_idx];
+                const float* box = &boxesPtr[box_idx * 4];
+                const float area = boxArea(box, m_normalized);
+                // as the reference does, a box scored exactly at the threshold is checked against the last selected one only
+                size_t suppress_begin_index = (score > m_scoreThreshold || selected.size() == 0) ? 0 : selected.size() - 1;
+                if (selected.suppresses(box, area, adaptive_threshold, true, suppress_begin_index))
+                    continue;
+
+                if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
+                    adaptive_threshold *= m_nmsEta;
+                }
+                m_filtBoxes[offset + selected.size()] = filteredBoxes(score, batch_idx, class_idx, box_idx);
+                selected.push_back(box, area);
             }
+            m_numFiltBox[batch_idx][class_idx] = selected.size();
         }
     });
 }
@@ -545,39 +500,25 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // align with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            std::vector<int> candidates(cur_numBoxes);
+            size_t candidatesNum = filterByScore(scoresPtr, cur_numBoxes, m_scoreThreshold, true, candidates.data());  // align with ref
+            size_t max_out_box = topKByScore(candidates.data(), candidatesNum, m_nmsRealTopk, scoresPtr);
 
+            NmsBoxes selected(NmsBoxes::Overlap::Positive, m_normalized ? 0.f : 1.f);
+            selected.reserve(max_out_box);
+            int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
             int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            for (size_t i = 0; i < max_out_box; i++) {
+                const int box_idx = candidates[i];
+                const float* box = &boxesPtr[box_idx * 4];
+                const float area = boxArea(box, m_normalized);
+                if (selected.suppresses(box, area, m_iouThreshold, true))
+                    continue;
+
+                selected.push_back(box, area);
+                m_filtBoxes[offset + io_selection_size] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
                 io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
             }
             m_numFiltBox[batch_idx][class_idx] = io_selection_size;
         }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -226,13 +227,19 @@ void RDFTExecutor::execute(float* inputPtr, float* outputPtr,
                            VectorDims inputShape, const VectorDims& outputShape,
                            const VectorDims& inputStrides, const VectorDims& outputStrides) {
     adjustInputSize(inputShape, signalSizes, outputShape, axes, isInverse);
+    for (size_t signalSize : signalSizes) {
+        if (canUseFFT(signalSize) && fftPlans.find(signalSize) == fftPlans.end())
+            fftPlans[signalSize] = std::make_shared<FFTPlan>(signalSize);
+    }
 
     if (rank == 1) {
         auto twiddlesPtr = twiddles[0].data();
-        dftCommon(inputPtr, twiddlesPtr, outputPtr,
+        const bool useFFT = canUseFFT(signalSizes[0]);
+        float* fftBuffer = useFFT ? getWorkBuffers(fftBufferSize(signalSizes[0]), 1) : nullptr;
+        dftCommon(inputPtr, twiddlesPtr, outputPtr, fftBuffer,
                    inputShape[0], signalSizes[0], outputShape[0],
                    isInverse ? complex_to_real : real_to_complex,
-                   canUseFFT(signalSizes[0]), false);
+                   useFFT, false);
     } else {
         if (!isInverse)
             rdftNd(inputPtr, outputPtr, twiddles, axes, signalSizes, inputShape, inputStrides, outputShape, outputStrides);
@@ -314,17 +321,31 @@ static size_t dftSimdSize(int vlen) {
     return vlen / (2 * sizeof(float));
 }
 
+// the DFT kernels are faster for the short signals, which are not split into the radix 2 stages
+static constexpr size_t MIN_NOT_POWER_OF_TWO_FFT_SIZE = 32;
+
 bool RDFTExecutor::canUseFFT(size_t dim) {
-    return isPowerOfTwo(dim) && dim > 1;
+    return dim > 1 && (isPowerOfTwo(dim) || dim >= MIN_NOT_POWER_OF_TWO_FFT_SIZE);
+}
+
+size_t RDFTExecutor::fftBufferSize(size_t signalSize) const {
+    // complex signal followed by the scratch of the plan
+    return 2 * (signalSize + fftPlans.at(signalSize)->scratchSize());
+}
+
+float* RDFTExecutor::getWorkBuffers(size_t bufferSize, size_t buffersNumber) {
+    if (workBuffers.size() < bufferSize * buffersNumber)
+        workBuffers.resize(bufferSize * buffersNumber);
+    return workBuffers.data();
 }
 
+// the missing part of the spectrum of a real signal is restored as X[i] = conj(X[signalSize - i])
 static void fftCopyInverseInputData(float* dst, float* src, size_t inputSize, size_t signalSize, bool parallelize) {
     if (!parallelize) {
         cpu_memcpy(dst, src, inputSize * complex_type_size<float>());
-        src = src + 2 * inputSize - 4;
-        for (size_t i = inputSize; i < signalSize; i++, src -= 2) {
-            dst[2 * i] = src[0];
-            dst[2 * i + 1] = -src[1];
+        for (size_t i = inputSize; i < signalSize; i++) {
+            dst[2 * i] = src[2 * (signalSize - i)];
+            dst[2 * i + 1] = -src[2 * (signalSize - i) + 1];
         }
     } else {
         parallel_for(signalSize, [&] (size_t i) {
@@ -332,7 +353,7 @@ static void fftCopyInverseInputData(float* dst, float* src, size_t inputSize, si
                     dst[2 * i] = src[2 * i];
                     dst[2 * i + 1] = src[2 * i + 1];
                 } else {
-                    size_t src_idx = 2 * inputSize - 2 - i;
+                    size_t src_idx = signalSize - i;
                     dst[2 * i] = src[2 * src_idx];
                     dst[2 * i + 1] = -src[2 * src_idx + 1];
                 }
@@ -354,92 +375,64 @@ static void fftCopyRealInputData(float* dst, float* src, size_t inputSize, bool
     }
 }
 
-static void fftCopyInverseRealOutput(float* dst, float* src, size_t signalSize, bool parallelize) {
+static void fftCopyInverseRealOutput(float* dst, float* src, size_t signalSize, float scale, bool parallelize) {
     if (!parallelize) {
         for (size_t i = 0; i < signalSize; i++) {
-            dst[i] = src[2 * i];
+            dst[i] = src[2 * i] * scale;
         }
     } else {
         parallel_for(signalSize, [&] (size_t i) {
-            dst[i] = src[2 * i];
+            dst[i] = src[2 * i] * scale;
+        });
+    }
+}
+
+static void fftCopyInverseComplexOutput(float* dst, float* src, size_t outputSize, float scale, bool parallelize) {
+    if (!parallelize) {
+        for (size_t i = 0; i < 2 * outputSize; i++) {
+            dst[i] = src[i] * scale;
+        }
+    } else {
+        parallel_for(outputSize, [&] (size_t i) {
+            dst[2 * i] = src[2 * i] * scale;
+            dst[2 * i + 1] = src[2 * i + 1] * scale;
         });
     }
 }
 
-void RDFTExecutor::fft(float* input, const float* twiddlesPtr, float* output,
+void RDFTExecutor::fft(float* input, const FFTPlan& plan, float* output, float* buffer,
                        size_t inputSize, size_t signalSize, size_t outputSize,
                        enum dft_type type, bool parallelize) {
-    std::vector<float> scratchSpace(4 * signalSize, 0);
-
-    float* inputPtr = input;
-    float* outputPtr = &scratchSpace[2 * signalSize];
-
-    if (inputSize < signalSize || type == real_to_complex) {
-        if (isInverse)
-            fftCopyInverseInputData(&scratchSpace[0], input, inputSize, signalSize, parallelize);
-        else if (type == real_to_complex)
-            fftCopyRealInputData(&scratchSpace[0], input, inputSize, parallelize);
-        inputPtr = &scratchSpace[0];
-    }
-
-    size_t numBlocks = 0;
-    size_t blockSize = 0;
-
-    auto blockIteration = [&] (size_t block) {
-        size_t inputOffset = block * blockSize;
-        size_t outputOffset = block * blockSize / 2;
-        float cos = twiddlesPtr[2 * block];
-        float sin = twiddlesPtr[2 * block + 1];
-        if (isInverse)
-            sin = -sin;
-        for (size_t pair = 0; pair < blockSize / 2; pair++) {
-            float evenReal = inputPtr[2 * (inputOffset + pair)];
-            float evenImag = inputPtr[2 * (inputOffset + pair) + 1];
-            float oddReal = inputPtr[2 * (inputOffset + blockSize / 2 + pair)];
-            float oddImag = inputPtr[2 * (inputOffset + blockSize / 2 + pair) + 1];
-            outputPtr[2 * (outputOffset + pair)] = evenReal + cos * oddReal - sin * oddImag;
-            outputPtr[2 * (outputOffset + pair) + 1] = evenImag + cos * oddImag + sin * oddReal;
-            outputPtr[2 * (outputOffset + signalSize / 2 + pair)] = evenReal - cos * oddReal + sin * oddImag;
-            outputPtr[2 * (outputOffset + signalSize / 2 + pair) + 1] = evenImag - cos * oddImag - sin * oddReal;
-            if (isInverse && numBlocks == signalSize / 2) {
-                outputPtr[2 * (outputOffset + pair)] /= signalSize;
-                outputPtr[2 * (outputOffset + pair) + 1] /= signalSize;
-                outputPtr[2 * (outputOffset + signalSize / 2 + pair)] /= signalSize;
-                outputPtr[2 * (outputOffset + signalSize / 2 + pair) + 1] /= signalSize;
-            }
-        }
-    };
+    float* data = buffer;
+    float* scratch = buffer + 2 * signalSize;
 
-    for (numBlocks = 1; numBlocks < signalSize; numBlocks *= 2) {
-        blockSize = signalSize / numBlocks;
-        if (numBlocks == signalSize / 2 && outputSize == signalSize && type != complex_to_real) {
-            outputPtr = output;
-        }
-        if (parallelize) {
-            parallel_for(numBlocks, blockIteration);
-        } else {
-            for (size_t block = 0; block < numBlocks; block++) {
-                blockIteration(block);
-            }
-        }
-        twiddlesPtr += numBlocks * 2;
-        if (numBlocks == 1 && inputPtr == input)
-            inputPtr = &scratchSpace[0];
-        std::swap(inputPtr, outputPtr);
+    if (isInverse && inputSize < signalSize) {
+        fftCopyInverseInputData(data, input, inputSize, signalSize, parallelize);
+    } else if (type == real_to_complex) {
+        fftCopyRealInputData(data, input, signalSize, parallelize);
+    } else {
+        const size_t copySize = std::min(inputSize, signalSize);
+        cpu_memcpy(data, input, copySize * complex_type_size<float>());
+        std::fill(data + 2 * copySize, data + 2 * signalSize, 0.f);
     }
 
+    plan.execute(data, scratch, isInverse, parallelize);
+
+    const float scale = isInverse ? 1.f / static_cast<float>(signalSize) : 1.f;
     if (type == complex_to_real) {
-        fftCopyInverseRealOutput(output, inputPtr, signalSize, parallelize);
-    } else if (outputSize != signalSize) {
-        cpu_memcpy(output, inputPtr, outputSize * complex_type_size<float>());
+        fftCopyInverseRealOutput(output, data, signalSize, scale, parallelize);
+    } else if (isInverse) {
+        fftCopyInverseComplexOutput(output, data, outputSize, scale, parallelize);
+    } else {
+        cpu_memcpy(output, data, outputSize * complex_type_size<float>());
     }
 }
 
-void RDFTExecutor::dftCommon(float* inputPtr, const float* twiddlesPtr, float* outputPtr,
+void RDFTExecutor::dftCommon(float* inputPtr, const float* twiddlesPtr, float* outputPtr, float* fftBuffer,
                               size_t inputSize, size_t signalSize, size_t outputSize,
                               enum dft_type type, bool useFFT, bool parallelize) {
     if (useFFT) {
-        fft(inputPtr, twiddlesPtr, outputPtr,
+        fft(inputPtr, *fftPlans.at(signalSize), outputPtr, fftBuffer,
             inputSize, signalSize, outputSize,
             type, parallelize);
     } else {
@@ -499,36 +492,34 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
                                            1, std::multiplies<size_t>()) / iterationRange[axis];
     bool parallelizeOuterAxes = totalWorkSize > signalSize;
 
-    if (parallelizeOuterAxes) {
-        parallel_for(totalWorkSize, [&] (size_t i) {
-            std::vector<size_t> coords(iterationRange.size(), 0);
-            std::vector<float> gatherScatterBuffer(gatherSize + scatterSize);
-            float* gatherBuffer = &gatherScatterBuffer[0];
-            float* scatterBuffer = &gatherScatterBuffer[gatherSize];
-            coordsFromIndex(i, coords, iterationRange, axis);
-            gather(gatherBuffer, inputPtr,
-                   axis, coords,
-                   inputSize, inputStrides);
-            dftCommon(gatherBuffer, twiddlesPtr, scatterBuffer,
-                       inputSize, signalSize, outputSize,
-                       type, useFFT, !parallelizeOuterAxes);
-            scatter(outputPtr, scatterBuffer, axis, coords, outputSize, outputStrides);
-        });
-    } else {
+    // every thread gathers a line, transforms it and scatters the result using its own part of the work buffers
+    const size_t bufferSize = gatherSize + scatterSize + (useFFT ? fftBufferSize(signalSize) : 0);
+    auto processLines = [&] (size_t start, size_t end, float* buffer) {
         std::vector<size_t> coords(iterationRange.size(), 0);
-        std::vector<float> gatherScatterBuffer(gatherSize + scatterSize);
-        float* gatherBuffer = &gatherScatterBuffer[0];
-        float* scatterBuffer = &gatherScatterBuffer[gatherSize];
-        for (size_t i = 0; i < totalWorkSize; i++) {
+        float* gatherBuffer = buffer;
+        float* scatterBuffer = buffer + gatherSize;
+        float* fftBuffer = useFFT ? scatterBuffer + scatterSize : nullptr;
+        for (size_t i = start; i < end; i++) {
             coordsFromIndex(i, coords, iterationRange, axis);
             gather(gatherBuffer, inputPtr,
                    axis, coords,
                    inputSize, inputStrides);
-            dftCommon(gatherBuffer, twiddlesPtr, scatterBuffer,
+            dftCommon(gatherBuffer, twiddlesPtr, scatterBuffer, fftBuffer,
                        inputSize, signalSize, outputSize,
                        type, useFFT, !parallelizeOuterAxes);
             scatter(outputPtr, scatterBuffer, axis, coords, outputSize, outputStrides);
         }
+    };
+
+    if (parallelizeOuterAxes) {
+        float* buffers = getWorkBuffers(bufferSize, parallel_get_max_threads());
+        parallel_nt(0, [&] (const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(totalWorkSize, nthr, ithr, start, end);
+            processLines(start, end, buffers + ithr * bufferSize);
+        });
+    } else {
+        processLines(0, totalWorkSize, getWorkBuffers(bufferSize, 1));
     }
 }
 
@@ -616,22 +607,11 @@ void RDFTExecutor::irdftNd(float* inputPtr, float* outputPtr,
                 iterationRange);
 }
 
-std::vector<float> RDFTExecutor::generateTwiddlesFFT(size_t N) {
-    std::vector<float> twiddles;
-    for (size_t numBlocks = 1; numBlocks < N; numBlocks *= 2) {
-        for (size_t block = 0; block < numBlocks; block++) {
-            double angle = 2 * PI * block / (numBlocks * 2);
-            twiddles.push_back(std::cos(angle));
-            twiddles.push_back(-std::sin(angle));
-        }
-    }
-    return twiddles;
-}
-
 std::vector<float> RDFTExecutor::generateTwiddlesCommon(size_t signalSize, size_t outputSize,
                                                           enum dft_type type, bool useFFT) {
     if (useFFT) {
-        return generateTwiddlesFFT(signalSize);
+        // FFT takes the twiddles from its plan
+        return {};
     }
     return generateTwiddlesDFT(signalSize, outputSize, type);
 }
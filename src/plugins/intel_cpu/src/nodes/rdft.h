@@ -8,7 +8,10 @@
 #include <node.h>
 #include <string>
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include "kernels/rdft_kernel.hpp"
+#include "common/fft.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -36,12 +39,14 @@ struct RDFTExecutor {
         virtual void dft(float* inputPtr, const float* twiddlesPtr, float* outputPtr,
                          size_t inputSize, size_t signalSize, size_t outputSize,
                          enum dft_type type, bool parallelize) = 0;
-        virtual void fft(float* input, const float* twiddlesPtr, float* output,
-                         size_t inputSize, size_t signalSize, size_t outputSize,
-                         enum dft_type type, bool parallelize);
-        void dftCommon(float* inputPtr, const float* twiddlesPtr, float* outputPtr,
+        void fft(float* input, const FFTPlan& plan, float* output, float* buffer,
+                 size_t inputSize, size_t signalSize, size_t outputSize,
+                 enum dft_type type, bool parallelize);
+        void dftCommon(float* inputPtr, const float* twiddlesPtr, float* outputPtr, float* fftBuffer,
                         size_t inputSize, size_t signalSize, size_t outputSize,
                         enum dft_type type, bool useFFT, bool parallelize);
+        size_t fftBufferSize(size_t signalSize) const;
+        float* getWorkBuffers(size_t bufferSize, size_t buffersNumber);
         void dftOnAxis(enum dft_type type,
                          float* inputPtr, float* outputPtr,
                          const float* twiddlesPtr, int axis,
@@ -68,9 +73,13 @@ struct RDFTExecutor {
                      const VectorDims& outputShape,
                      const VectorDims& outputStrides);
         virtual std::vector<float> generateTwiddlesDFT(size_t inputSize, size_t outputSize, enum dft_type type) = 0;
-        std::vector<float> generateTwiddlesFFT(size_t N);
         std::vector<float> generateTwiddlesCommon(size_t inputSize, size_t outputSize,
                                                   enum dft_type type, bool useFFT);
+
+        // FFT plans for the signal sizes, built on the first use of a size
+        std::unordered_map<size_t, std::shared_ptr<FFTPlan>> fftPlans;
+        // per thread gather, scatter and FFT buffers, kept between the inferences
+        std::vector<float> workBuffers;
 };
 
 class RDFT : public Node {
@@ -10,6 +10,7 @@
 #include "ie_parallel.hpp"
 #include <algorithm>
 #include "common/cpu_memcpy.h"
+#include "common/ordered_scatter.h"
 
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
@@ -368,11 +369,9 @@ void ScatterUpdate::execute(dnnl::stream strm) {
 void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
     const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
     const auto& indicesDim = getParentEdgeAt(INDICES_ID)->getMemory().getStaticDims();
-    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
     size_t indicesRank = indicesDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
-    std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
     const size_t mulIdentity = 1;
     size_t idxLength = mulIdentity;
@@ -387,12 +386,14 @@ void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, u
     size_t blockToUpdate = srcBlockND[axis + 1];
     size_t blockToUpdateSize = blockToUpdate * dataSize;
 
+    // the update blocks are in the (b, idx) order, their destinations are counted in blocks
+    std::vector<size_t> dstOffsets(batchToUpdate * idxLength);
     parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
         int64_t idxValue = getIndicesValue(indices, idx);
-        uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
-        uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
-        cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+        dstOffsets[b * idxLength + idx] = b * srcDataDim[axis] + idxValue;
     });
+    scatterBlocks(dstData, batchToUpdate * srcDataDim[axis], update, dstOffsets.data(), dstOffsets.size(),
+                  blockToUpdateSize);
 }
 
 // indices is a (q-1)-dimension tensor of k-tuple,
@@ -412,17 +413,18 @@ void ScatterUpdate::scatterNDUpdate(uint8_t *indices, uint8_t *update, uint8_t *
     }
 
     size_t sizeToUpdate = srcBlockND[k] * dataSize;
+    // destinations of the slices are counted in slices
+    std::vector<size_t> dstOffsets(idxTupleNum);
     parallel_for(idxTupleNum, [&](size_t tupleIdx) {
         size_t indicesOffset = tupleIdx * k;
         size_t dstOffset = 0;
         for (int i = 0; i < k; i++) {
             size_t idxValue = getIndicesValue(indices, indicesOffset + i);
-            dstOffset += idxValue * srcBlockND[i + 1];
+            dstOffset += idxValue * (srcBlockND[i + 1] / srcBlockND[k]);
         }
-        dstOffset *= dataSize;
-        size_t updateOffset = tupleIdx * sizeToUpdate;
-        cpu_memcpy(dstData + dstOffset, update + updateOffset, sizeToUpdate);
+        dstOffsets[tupleIdx] = dstOffset;
     });
+    scatterBlocks(dstData, srcBlockND[0] / srcBlockND[k], update, dstOffsets.data(), idxTupleNum, sizeToUpdate);
 }
 
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
@@ -436,6 +438,8 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
     std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
+    // destinations of the update elements, the out of range indices are skipped
+    std::vector<size_t> dstOffsets(updateBlockND[0]);
     parallel_nt(0, [&](const int ithr, const int nthr) {
         int j;
         size_t i, dst_idx = 0, start = 0, end = 0;
@@ -453,9 +457,8 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
 
         for (size_t iwork = start; iwork < end; iwork++) {
             int64_t idxValue = getIndicesValue(indices, iwork);
-            if (idxValue < srcDataDim[axis])
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
+            dstOffsets[iwork] = idxValue < srcDataDim[axis] ? dst_idx + idxValue * srcBlockND[axis + 1]
+                                                            : srcBlockND[0];
 
             for (j = updateRank - 1; j >= 0; j--) {
                 tensorItr[j]++;
@@ -473,6 +476,7 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
             }
         }
     });
+    scatterBlocks(dstData, srcBlockND[0], update, dstOffsets.data(), dstOffsets.size(), dataSize);
 }
 
 bool ScatterUpdate::created() const {
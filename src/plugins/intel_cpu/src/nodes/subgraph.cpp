@@ -22,6 +22,8 @@
 
 #include <snippets/op/subgraph.hpp>
 #include "emitters/cpu_generator.hpp"
+#include "common/snippet_kernel_cache.h"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace InferenceEngine;
 using namespace dnnl::impl::utils;
@@ -32,35 +34,76 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+struct SnippetKey {
+    const ngraph::snippets::op::Subgraph* snippet;
+    std::vector<bool> broadcastingPattern;
+    size_t harnessNumDims;
+
+    size_t hash() const;
+    bool operator==(const SnippetKey& rhs) const;
+};
+
+size_t SnippetKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, snippet);
+    for (const bool isBroadcasted : broadcastingPattern)
+        seed = hash_combine(seed, isBroadcasted);
+    seed = hash_combine(seed, harnessNumDims);
+    return seed;
+}
+
+bool SnippetKey::operator==(const SnippetKey& rhs) const {
+    return snippet == rhs.snippet &&
+           broadcastingPattern == rhs.broadcastingPattern &&
+           harnessNumDims == rhs.harnessNumDims;
+}
+
+} // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(op, eng, cache) {
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ?
         dnnl::impl::cpu::x64::avx512_core : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
+    // Create a deep local copy of the input snippet to perform canonicalization
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        snippet = copy_snippet(tmp_snippet);
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
 }
 
+// Todo: Probably better to implement a proper copy constructor
+std::shared_ptr<ngraph::snippets::op::Subgraph> Snippet::copy_snippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original) {
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : original->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*original->get_body().get());
+    auto copy = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original, copy);
+    copy->set_friendly_name(original->get_friendly_name());
+    return copy;
+}
+
 void Snippet::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    const Precision supportedPrecision = Precision::FP32;
+    // Low precision tensors are converted to FP32 by Loads and Stores, so the ports keep the original precisions,
+    // Stores convert to BF16 only
+    auto getPortPrecision = [](const ov::element::Type& type, bool isInput) -> Precision {
+        const auto prc = InferenceEngine::details::convertPrecision(type);
+        if (isInput)
+            return one_of(prc, Precision::BF16, Precision::I8, Precision::U8) ? prc : Precision::FP32;
+        return prc == Precision::BF16 ? prc : Precision::FP32;
+    };
 
     bool dimRanksAreEqual = true;
     for (size_t i = 0; dimRanksAreEqual && i < inputShapes.size(); i++) {
@@ -71,11 +114,13 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // Reductions are performed over the innermost logical dimension, so it must be the innermost in memory as well
+    const bool hasReductions = snippet->has_reductions();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -132,7 +177,7 @@ void Snippet::initSupportedPrimitiveDescriptors() {
             if (inputShapes[i].getDims()[0] == 1) {
                 inputMask.reset(0); // accepts any stride on batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(inputShapes[i], supportedPrecision, offset), inputMask);
+            portConfig.setMemDesc(createMemoryDesc(inputShapes[i], getPortPrecision(snippet->get_input_element_type(i), true), offset), inputMask);
             config.inConfs[i] = portConfig;
         }
         config.outConfs.resize(outputShapes.size());
@@ -144,7 +189,7 @@ void Snippet::initSupportedPrimitiveDescriptors() {
             if (outputShapes[i].getDims()[0] == 1) {
                 outputMask.reset(0); // accepts any stride on batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(outputShapes[i], supportedPrecision, offset), outputMask);
+            portConfig.setMemDesc(createMemoryDesc(outputShapes[i], getPortPrecision(snippet->get_output_element_type(i), false), offset), outputMask);
             config.outConfs[i] = portConfig;
         }
 
@@ -168,24 +213,44 @@ void Snippet::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
 }
 
-void Snippet::createPrimitive() {
+void Snippet::prepareParams() {
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
+    if (fullWorkAmount == 0)
+        return;
 
     // code generation part
-    // it might be worth to generate explicitly for scheduler work amount for now,
-    // but in future some interface should be defined in order to communicate schedule for a kernel
-    // or generate schedule for a kernel.
+    // Generated code doesn't depend on the actual dims: work amounts and offsets are passed to the kernel in runtime.
+    // So the kernel is generated only once for every broadcasting pattern and then reused for all the other shapes.
     // Here kernel is generated for most warying dimension by default.
-    generate();
+    const size_t harness_num_dims = std::min(tensorRank - 1, static_cast<size_t>(SNIPPETS_MAX_HARNESS_DIMS));
+    canUseOptimizedImpl = tensorRank - 1 <= SNIPPETS_MAX_HARNESS_DIMS;
+    SnippetKey key = {snippet.get(), get_broadcasting_pattern(), harness_num_dims};
+
+    auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetJitKernel> {
+        std::string bodySignature;
+        if (!getSnippetBodySignature(*snippet, bodySignature))
+            return generate();
+        SharedKernelKey sharedKey = {std::move(bodySignature), key.broadcastingPattern, key.harnessNumDims,
+                                     static_cast<int>(host_isa)};
+        return SharedKernelCache<SnippetJitKernel>::getInstance().getOrCreate(sharedKey, [this]() { return generate(); });
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    jit_kernel = result.first;
+
+    init_call_args();
 }
 
 void Snippet::execute(dnnl::stream strm) {
-    if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
+    if (fullWorkAmount == 0)
+        return;
+    if (!jit_kernel || jit_kernel->schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
-    jit_snippets_call_args call_args;
+    jit_snippets_call_args call_args = call_args_template;
     for (size_t i = 0; i < srcMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(srcMemPtrs[i]->GetData()) + start_offset_in[i];
 
@@ -199,6 +264,10 @@ void Snippet::execute(dnnl::stream strm) {
     }
 }
 
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 bool Snippet::created() const {
     return getType() == Type::Subgraph;
 }
@@ -264,11 +333,16 @@ void Snippet::define_schedule() {
         std::copy(dims.begin(), dims.end(), &result[tensorRank - dims.size()]);
         return result;
     };
-    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
+    // define_schedule() is called every time the input shapes are changed, so all the scheduling info is reset here
+    tileRank = 1;
+    dims_in.clear();
+    dims_out.clear();
+
+    input_blocked_shapes.clear();
     for (size_t i = 0; i < inputShapes.size(); i++)
         input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
 
-    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
+    output_blocked_shapes.clear();
     for (size_t i = 0; i < outputShapes.size(); i++)
         output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
     exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
@@ -287,8 +361,13 @@ void Snippet::define_schedule() {
     }
 
     const auto config = getSelectedPrimitiveDescriptor()->getConfig();
-    const auto dataSize = config.inConfs[0].getMemDesc()->getPrecision().size();
-    auto initOffsets = [this, config, dataSize]() {
+    // Ports may have different precisions, so the offsets are computed in bytes of the corresponding port
+    std::vector<int64_t> dataSizesIn(config.inConfs.size()), dataSizesOut(config.outConfs.size());
+    for (size_t i = 0; i < config.inConfs.size(); i++)
+        dataSizesIn[i] = config.inConfs[i].getMemDesc()->getPrecision().size();
+    for (size_t i = 0; i < config.outConfs.size(); i++)
+        dataSizesOut[i] = config.outConfs[i].getMemDesc()->getPrecision().size();
+    auto initOffsets = [this, config, &dataSizesIn, &dataSizesOut]() {
         // find max rank input among all outputs
         const size_t inputNum = getParentEdges().size();
         offsets_in.resize(inputNum);
@@ -296,7 +375,7 @@ void Snippet::define_schedule() {
             offsets_in[i].resize(tensorRank, 1);
             offset_calculation(offsets_in[i], dims_in[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_in[i][j] *= dataSize;
+                offsets_in[i][j] *= dataSizesIn[i];
             }
         }
 
@@ -305,7 +384,7 @@ void Snippet::define_schedule() {
         for (size_t i = 0; i < inputNum; i++) {
             const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
             srcMemPtrs[i] = memPtr;
-            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
+            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSizesIn[i];
         }
 
         const size_t outputNum = config.outConfs.size();
@@ -314,7 +393,7 @@ void Snippet::define_schedule() {
             offsets_out[i].resize(tensorRank, 1);
             offset_calculation(offsets_out[i], dims_out[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_out[i][j] *= dataSize;
+                offsets_out[i][j] *= dataSizesOut[i];
             }
         }
 
@@ -323,11 +402,13 @@ void Snippet::define_schedule() {
         for (size_t i = 0; i < outputNum; i++) {
             const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
             dstMemPtrs[i] = memPtr;
-            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
+            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSizesOut[i];
         }
     };
 
-    auto find_dims_to_collapse = [this, config]() -> int {
+    // The innermost dimension is reduced by the kernel as a whole, so it can't be merged with the outer ones
+    const bool hasReductions = snippet->has_reductions();
+    auto find_dims_to_collapse = [this, config, hasReductions]() -> int {
         int collapsedDims = 0;
         size_t minimalConcurrency = parallel_get_max_threads();
         size_t minimalJitWorkAmount = 256;
@@ -336,8 +417,8 @@ void Snippet::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
+            bool canCollapse = !hasReductions;
+            for (size_t i = 0; canCollapse && i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
@@ -373,11 +454,11 @@ void Snippet::define_schedule() {
         return collapsedDims;
     };
 
-    auto initSchedulingInfo = [this, dataSize]() -> void {
+    auto initSchedulingInfo = [this, &dataSizesIn, &dataSizesOut]() -> void {
         // initialize scheduling information
-        sch_offsets_in.resize(offsets_in.size(), 0);
-        sch_offsets_out.resize(offsets_out.size(), 0);
-        sch_dims.resize(maxTileRank, 1);
+        sch_offsets_in.assign(offsets_in.size(), 0);
+        sch_offsets_out.assign(offsets_out.size(), 0);
+        sch_dims.assign(maxTileRank, 1);
         sch_dims[maxTileRank-1] = exec_domain.back();
         schedulerWorkAmount = fullWorkAmount / exec_domain.back();
         if (tileRank > 1) {
@@ -388,16 +469,16 @@ void Snippet::define_schedule() {
             // update offsets for tile 2D because loaders have ptr shifts in some cases and stores have always ptrs shifts
             for (size_t i = 0; i < offsets_in.size(); i++) {
                 int64_t offset = offsets_in[i][tensorRank - 2];
-                if ((offset > dataSize) || (offset == 0 && dims_in[i].back() != 1)) {
-                    sch_offsets_in[i] = offset - exec_domain.back() * dataSize;
-                } else if (offset == dataSize) {
+                if ((offset > dataSizesIn[i]) || (offset == 0 && dims_in[i].back() != 1)) {
+                    sch_offsets_in[i] = offset - exec_domain.back() * dataSizesIn[i];
+                } else if (offset == dataSizesIn[i]) {
                     sch_offsets_in[i] = offset;
                 }
             }
 
             for (size_t i = 0; i < offsets_out.size(); i++) {
                 int64_t offset = offsets_out[i][tensorRank - 2];
-                sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+                sch_offsets_out[i] = offset - exec_domain.back() * dataSizesOut[i];
             }
         }
     };
@@ -406,6 +487,9 @@ void Snippet::define_schedule() {
     for (const auto &d : exec_domain) {
         fullWorkAmount *= d;
     }
+    // nothing to schedule for empty tensors
+    if (fullWorkAmount == 0)
+        return;
 
     batchDimIdx = tensorRank - exec_domain.size();
     // Note that exec_domain can be modified inside find_dims_to_collapse() and/or initSchedulingInfo()
@@ -415,26 +499,52 @@ void Snippet::define_schedule() {
     initSchedulingInfo();
 }
 
-void Snippet::generate() {
+std::vector<bool> Snippet::get_broadcasting_pattern() const {
+    // Lowering passes (InsertMoveBroadcast, LoadMoveBroadcastToBroadcastLoad, ReplaceLoadsWithScalarLoads)
+    // depend only on whether the innermost dims of the canonicalized shapes are broadcasted,
+    // all the outer dims are handled by the runtime offsets
+    auto isInnermostDimBroadcasted = [](const ngraph::Shape& shape) {
+        return shape.empty() || shape.back() == 1;
+    };
+    const auto& body = snippet->get_body();
+    std::vector<bool> pattern;
+    for (const auto& p : body->get_parameters())
+        pattern.push_back(isInnermostDimBroadcasted(p->get_shape()));
+    for (const auto& r : body->get_results())
+        pattern.push_back(isInnermostDimBroadcasted(r->get_input_shape(0)));
+    return pattern;
+}
+
+Snippet::KernelCacheStatistics Snippet::getKernelCacheStatistics() {
+    return SharedKernelCache<SnippetJitKernel>::getInstance().getStatistics();
+}
+
+std::shared_ptr<Snippet::SnippetJitKernel> Snippet::generate() const {
     jit_snippets_compile_args jcp;
-    jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
-    if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
-        canUseOptimizedImpl = false;
-        harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
-    }
+    jcp.harness_num_dims = std::min(tensorRank - 1, static_cast<size_t>(SNIPPETS_MAX_HARNESS_DIMS));
+
+    // Code generation lowers the body, so it's performed on a separate copy which then owns the generated code
+    auto result = std::make_shared<SnippetJitKernel>();
+    result->snippet = copy_snippet(snippet);
+    result->snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    result->schedule = result->snippet->generate(output_blocked_shapes, input_blocked_shapes, reinterpret_cast<void*>(&jcp));
+    return result;
+}
+
+void Snippet::init_call_args() {
+    call_args_template = jit_snippets_call_args();
+    std::copy(sch_dims.begin(), sch_dims.end(), call_args_template.scheduler_work_amounts);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), call_args_template.scheduler_offsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &call_args_template.scheduler_offsets[sch_offsets_in.size()]);
+    const size_t harness_num_dims = std::min(tensorRank - 1, static_cast<size_t>(SNIPPETS_MAX_HARNESS_DIMS));
     for (size_t i = 0; i < inputShapes.size(); i++) {
         auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &call_args_template.data_offsets[i * harness_num_dims]);
     }
     for (size_t i = 0; i < outputShapes.size(); i++) {
         auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &call_args_template.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
     }
-    schedule = snippet->generate(reinterpret_cast<void*>(&jcp));
 }
 
 void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
@@ -443,7 +553,7 @@ void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
         [&](int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) {
             int64_t indexes[] = {d0, d1, d2, d3, d4};
-            schedule.get_callable<kernel>()(indexes, &call_args);
+            jit_kernel->schedule.get_callable<kernel>()(indexes, &call_args);
         });
 }
 
@@ -461,7 +571,7 @@ void Snippet::schedule_nt(const jit_snippets_call_args& call_args) const {
                 tmp /= work_size[j];
             }
 
-            schedule.get_callable<kernel>()(indexes.data(), &call_args);
+            jit_kernel->schedule.get_callable<kernel>()(indexes.data(), &call_args);
         }
     });
 }
@@ -12,6 +12,7 @@
 
 #include <node.h>
 #include "snippets/op/subgraph.hpp"
+#include "common/snippet_kernel_cache.h"
 
 #include <array>
 
@@ -32,32 +33,57 @@ public:
     void selectOptimalPrimitiveDescriptor() override;
 
     // Here we convert to canonical for & jit everything
-    void createPrimitive() override;
+    void prepareParams() override;
 
     bool canBeInPlace() const override;
     bool created() const override;
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    // Generated code along with the local subgraph copy that owns it
+    struct SnippetJitKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+
+    // Generated kernels are shared by all the nodes with structurally identical bodies (across streams and models)
+    using KernelCacheStatistics = SharedKernelCacheStatistics;
+    static KernelCacheStatistics getKernelCacheStatistics();
 
 private:
     static const size_t rank6D {6};
 
     typedef void (*kernel)(const void *, const void *);
 
+    static std::shared_ptr<ngraph::snippets::op::Subgraph> copy_snippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original);
+
     void define_schedule();
 
-    void generate();
+    // Returns the broadcasting pattern of the canonicalized body, the generated code depends on it (but not on the actual dims)
+    std::vector<bool> get_broadcasting_pattern() const;
+
+    std::shared_ptr<SnippetJitKernel> generate() const;
+
+    void init_call_args();
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
 
-    // Local copy of subgraph node for canonization & code generation
+    // Local copy of subgraph node for canonization, it's never lowered, so it could be canonicalized
+    // again each time input shapes are changed
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
     // Holds generated snippet with information about how to schedule it
-    ngraph::snippets::Schedule schedule;
+    std::shared_ptr<SnippetJitKernel> jit_kernel;
+
+    // Runtime arguments (work amounts and data offsets) for the current shapes
+    jit_snippets_call_args call_args_template;
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes = {};
+    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes = {};
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
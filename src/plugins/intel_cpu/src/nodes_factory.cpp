@@ -88,6 +88,7 @@
 #include "nodes/priorbox.h"
 #include "nodes/priorbox_clustered.h"
 #include "nodes/eye.h"
+#include "nodes/image_preprocess.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -188,6 +189,7 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(PriorBox, Type::PriorBox);
     INTEL_CPU_NODE(PriorBoxClustered, Type::PriorBoxClustered);
     INTEL_CPU_NODE(Eye, Type::Eye);
+    INTEL_CPU_NODE(ImagePreprocess, Type::ImagePreprocess);
 }
 
 #undef INTEL_CPU_NODE
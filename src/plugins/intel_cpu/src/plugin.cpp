@@ -83,6 +83,7 @@
 #include <transformations/utils/utils.hpp>
 #include <snippets/pass/collapse_subgraph.hpp>
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
+#include "ngraph_transformations/fuse_image_preprocess.hpp"
 #include <transformations/op_conversions/convert_roi_align_v9_to_v3.hpp>
 #include <transformations/op_conversions/convert_roi_align_v3_to_v9.hpp>
 #include <transformations/op_conversions/softsign_decomposition.hpp>
@@ -253,6 +254,8 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    // must see the preprocessing chain exactly as PrePostProcessor built it
+    manager.register_pass<FuseImagePreprocess>();
 
     const bool useLpt =
             _enableLPT &&
@@ -615,7 +618,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -623,7 +626,12 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                     const auto& outputs = n->outputs();
                     const bool bad_output_rank = std::any_of(outputs.begin(), outputs.end(),
                                                              [&](const ov::Output<const ov::Node>& out) {return  rank_is_too_large(out.get_tensor());});
-                    return has_only_const_inputs || bad_input_rank || bad_output_rank;
+                    // bf16 stores are implemented only for avx512 (native or emulated vcvtneps2bf16)
+                    const bool unsupported_bf16_output = !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) &&
+                                                         std::any_of(outputs.begin(), outputs.end(), [](const ov::Output<const ov::Node>& out) {
+                                                             return out.get_element_type() == ov::element::bf16;
+                                                         });
+                    return has_only_const_inputs || bad_input_rank || bad_output_rank || unsupported_bf16_output;
                 });
         tokenization_manager.run_passes(nGraphFunc);
     }
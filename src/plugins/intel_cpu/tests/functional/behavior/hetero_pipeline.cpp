@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// this tests load plugin by library name: this is not available during static linkage
+#ifndef OPENVINO_STATIC_LIBRARY
+
+/*
+    The model is split into three subgraphs by the affinities, so a pipelined request passes
+    CPU0 -> CPU1 -> CPU0, and the requests started together occupy the stages concurrently.
+
+        Param -> Relu (CPU0) -> Multiply (CPU1) -> Add (CPU0) -> Result
+*/
+class HeteroPipelineCPUTest : public ::testing::Test {
+protected:
+    static constexpr size_t size = 64;
+    static constexpr size_t requestsNumber = 8;
+
+    void SetUp() override {
+        for (auto&& device : {"CPU0", "CPU1"}) {
+            ie.RegisterPlugin(std::string("openvino_intel_cpu_plugin") + IE_BUILD_POSTFIX, device);
+            // several requests of every subgraph can be in flight
+            ie.SetConfig({{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}}, device);
+        }
+
+        auto param = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, size});
+        auto relu = std::make_shared<ngraph::opset8::Relu>(param);
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(
+            relu, ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {2.f}));
+        auto add = std::make_shared<ngraph::opset8::Add>(
+            multiply, ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.f}));
+        relu->get_rt_info()["affinity"] = std::string("CPU0");
+        multiply->get_rt_info()["affinity"] = std::string("CPU1");
+        add->get_rt_info()["affinity"] = std::string("CPU0");
+        network = CNNNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{add},
+                                                                ngraph::ParameterVector{param},
+                                                                "HeteroPipeline"));
+    }
+
+    static float input(size_t request, size_t i) {
+        return static_cast<float>(static_cast<int>(i) - static_cast<int>(size / 2) + static_cast<int>(request));
+    }
+
+    Core ie;
+    CNNNetwork network;
+};
+
+TEST_F(HeteroPipelineCPUTest, ConcurrentRequestsMatchReference) {
+    auto execNetwork = ie.LoadNetwork(network, "HETERO:CPU0,CPU1", {{HETERO_CONFIG_KEY(PIPELINE), CONFIG_VALUE(YES)}});
+    ASSERT_FALSE(execNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    std::vector<InferRequest> requests;
+    for (size_t r = 0; r < requestsNumber; r++) {
+        requests.push_back(execNetwork.CreateInferRequest());
+        auto blob = requests.back().GetBlob(inputName);
+        auto data = blob->buffer().as<float*>();
+        for (size_t i = 0; i < size; i++)
+            data[i] = input(r, i);
+    }
+
+    // a few rounds, so that the requests enter the stages in different orders
+    for (size_t round = 0; round < 4; round++) {
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+        for (size_t r = 0; r < requestsNumber; r++) {
+            auto blob = requests[r].GetBlob(outputName);
+            auto data = blob->cbuffer().as<const float*>();
+            for (size_t i = 0; i < size; i++) {
+                ASSERT_EQ(std::max(input(r, i), 0.f) * 2.f + 1.f, data[i])
+                    << "round " << round << ", request " << r << ", element " << i;
+            }
+        }
+    }
+}
+
+TEST_F(HeteroPipelineCPUTest, ExclusiveAsyncRequestsAreKeptWithoutPipeline) {
+    auto execNetwork = ie.LoadNetwork(network, "HETERO:CPU0,CPU1");
+    ASSERT_TRUE(execNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+    execNetwork = ie.LoadNetwork(network, "HETERO:CPU0,CPU1", {{CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS), CONFIG_VALUE(NO)}});
+    ASSERT_FALSE(execNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+}
+
+TEST_F(HeteroPipelineCPUTest, PipelineWithExclusiveAsyncRequestsThrows) {
+    ASSERT_THROW(ie.LoadNetwork(network, "HETERO:CPU0,CPU1",
+                                {{HETERO_CONFIG_KEY(PIPELINE), CONFIG_VALUE(YES)},
+                                 {CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS), CONFIG_VALUE(YES)}}),
+                 Exception);
+}
+
+#endif // !OPENVINO_STATIC_LIBRARY
+
+}  // namespace
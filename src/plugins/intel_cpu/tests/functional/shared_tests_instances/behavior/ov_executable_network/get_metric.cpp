@@ -9,6 +9,7 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <gtest/gtest.h>
 
@@ -113,6 +114,26 @@ TEST_F(OVClassConfigTestCPU, smoke_CheckModelStreamsHasHigherPriorityThanThrough
     ASSERT_EQ(streams, value);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CheckCoreBudgetKeepsModelProperties) {
+    ov::Core ie;
+    ov::AnyMap config;
+    config[ov::intel_cpu::core_budget.name()] = true;
+    config[ov::hint::model_priority.name()] = ov::hint::Priority::HIGH;
+    config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
+    config[ov::hint::num_requests.name()] = 2;
+    config[ov::enable_profiling.name()] = true;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+
+    // the granted streams are reported along with the properties the model was compiled with
+    ASSERT_EQ(ov::hint::PerformanceMode::THROUGHPUT, compiledModel.get_property(ov::hint::performance_mode));
+    ASSERT_EQ(2u, compiledModel.get_property(ov::hint::num_requests));
+    ASSERT_TRUE(compiledModel.get_property(ov::enable_profiling));
+    ASSERT_EQ(ov::hint::Priority::HIGH, compiledModel.get_property(ov::hint::model_priority));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::core_budget));
+    ASSERT_LE(1, compiledModel.get_property(ov::num_streams));
+}
+
 const std::vector<ov::AnyMap> multiDevicePriorityConfigs = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU)}};
 
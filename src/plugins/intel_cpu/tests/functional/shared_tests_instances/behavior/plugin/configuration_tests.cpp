@@ -3,7 +3,9 @@
 //
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_system_conf.h"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "behavior/plugin/configuration_tests.hpp"
 
 using namespace BehaviorTestsDefinitions;
@@ -54,6 +56,11 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_HUGE_PAGES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_HUGE_PAGES, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "0.8"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "1"}},
             // check that hints doesn't override customer value (now for streams and later for other config opts)
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT},
              {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "3"}},
@@ -147,7 +154,11 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "should be int"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_HUGE_PAGES, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "-0.1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "1.5"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "HALF"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -100,8 +100,26 @@ const auto testCase4D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* Spectrogram frame sizes: mixed radix and Bluestein (prime factor) lengths */
+
+const std::vector<std::vector<size_t>> frameShapes = {
+    {4, 400, 2},
+    {2, 480, 2},
+    {1, 1200, 2},
+    {3, 257, 2},
+};
+
+const auto testCaseFrames = ::testing::Combine(
+    ::testing::ValuesIn(frameShapes),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::Values(std::vector<int64_t>{1}),
+    ::testing::Values(std::vector<int64_t>{}),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
 
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_frames, DFTLayerTest, testCaseFrames, DFTLayerTest::getTestCaseName);
@@ -30,6 +30,36 @@ namespace {
             ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                              AddSinh::getTestCaseName);
 
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Softmax, AddSinhSoftmax,
+            ::testing::Combine(
+            ::testing::Values(ov::Shape {1, 42, 16, 64}),
+            ::testing::Values(ov::Shape {1, 42, 16,  1}),
+            ::testing::Values(3), // Subgraph (Add + Softmax) + 2 converts after inputs
+            ::testing::Values(1), // Softmax over the innermost axis is tokenized together with Add
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             AddSinhSoftmax::getTestCaseName);
+
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_SoftmaxTail, AddSinhSoftmax,
+            ::testing::Combine(
+            ::testing::Values(ov::Shape {1, 3, 5, 17}),
+            ::testing::Values(ov::Shape {1, 3, 5, 17}),
+            ::testing::Values(3), // Innermost dim is not a multiple of vector length, so the scalar tail is exercised
+            ::testing::Values(1),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             AddSinhSoftmax::getTestCaseName);
+
+    // Fractional results of the subgraph are converted to integer by the standalone Convert (truncation),
+    // the fused Store would round them to nearest
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_ConvertToInteger, AddSinhConvert,
+            ::testing::Combine(
+            ::testing::Values(ov::Shape {1, 3, 5, 17}),
+            ::testing::Values(ov::Shape {1, 3, 5, 17}),
+            ::testing::Values(ov::element::i8, ov::element::u8),
+            ::testing::Values(4), // Subgraph (Add) + Convert + 2 Sinh
+            ::testing::Values(1),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             AddSinhConvert::getTestCaseName);
+
 }  // namespace
 } // namespace snippets
 } // namespace test
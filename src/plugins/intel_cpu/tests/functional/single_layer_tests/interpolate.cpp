@@ -556,6 +556,74 @@ INSTANTIATE_TEST_SUITE_P(InterpolateLinear_Layout_Test, InterpolateLayerCPUTest,
             ::testing::ValuesIn(filterAdditionalConfig())),
     InterpolateLayerCPUTest::getTestCaseName);
 
+std::vector<CPUSpecificParams> filterCPUInfoForDeviceLinear4D() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw16c, x, x, x}, {nChw16c}, {"ref"}, "ref"});
+        resCPUParams.push_back(CPUSpecificParams{{nhwc, x, x, x}, {nhwc}, {"ref"}, "ref"});
+    } else if (InferenceEngine::with_cpu_x86_sse42()) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c, x, x, x}, {nChw8c}, {"ref"}, "ref"});
+        resCPUParams.push_back(CPUSpecificParams{{nhwc, x, x, x}, {nhwc}, {"ref"}, "ref"});
+    }
+    resCPUParams.push_back(CPUSpecificParams{{nchw, x, x, x}, {nchw}, {"ref"}, "ref"});
+    return resCPUParams;
+}
+
+const std::vector<ShapeParams> shapeParams4D_Downscale = {
+    ShapeParams{
+        ngraph::op::v4::Interpolate::ShapeCalcMode::SCALES,
+        InputShape{{}, {{1, 11, 8, 8}}},
+        ngraph::helpers::InputLayerType::CONSTANT,
+        {{1.f, 1.f, 0.5f, 0.75f}},
+        defaultAxes4D.front()
+    },
+    ShapeParams{
+        ngraph::op::v4::Interpolate::ShapeCalcMode::SIZES,
+        InputShape{{}, {{1, 11, 9, 16}}},
+        ngraph::helpers::InputLayerType::CONSTANT,
+        {{1, 11, 4, 7}},
+        defaultAxes4D.front()
+    },
+    ShapeParams{
+        ngraph::op::v4::Interpolate::ShapeCalcMode::SIZES,
+        InputShape{{-1, {2, 20}, -1, -1}, {{1, 11, 8, 8}, {2, 7, 12, 10}, {1, 11, 8, 8}}},
+        ngraph::helpers::InputLayerType::PARAMETER,
+        {{1, 11, 3, 6}, {2, 7, 5, 12}, {1, 11, 3, 6}},
+        defaultAxes4D.front()
+    }
+};
+
+// linear with antialias is not mapped to linear_onnx, it goes to the separable linear filter as the 5D case
+const auto interpolateCasesLinearAntialias_Smoke = ::testing::Combine(
+        ::testing::Values(ngraph::op::v4::Interpolate::InterpolateMode::linear),
+        ::testing::ValuesIn(coordinateTransformModes_Smoke),
+        ::testing::ValuesIn(defNearestModes),
+        ::testing::Values(true),
+        ::testing::ValuesIn(pads4D),
+        ::testing::ValuesIn(pads4D),
+        ::testing::ValuesIn(cubeCoefs));
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterpolateLinearAntialias_Layout_Test, InterpolateLayerCPUTest,
+        ::testing::Combine(
+            interpolateCasesLinearAntialias_Smoke,
+            ::testing::ValuesIn(shapeParams4D_Downscale),
+            ::testing::Values(ElementType::f32),
+            ::testing::ValuesIn(filterCPUInfoForDeviceLinear4D()),
+            ::testing::ValuesIn(interpolateFusingParamsSet),
+            ::testing::ValuesIn(filterAdditionalConfig())),
+    InterpolateLayerCPUTest::getTestCaseName);
+
+// the channels number isn't a multiple of the block size, so the post ops skip the padded tail of the last block
+INSTANTIATE_TEST_SUITE_P(smoke_InterpolateLinearAntialias_Layout_PerChannelFuse_Test, InterpolateLayerCPUTest,
+        ::testing::Combine(
+            interpolateCasesLinearAntialias_Smoke,
+            ::testing::Values(shapeParams4D_Downscale[0], shapeParams4D_Downscale[1]),
+            ::testing::Values(ElementType::f32),
+            ::testing::ValuesIn(filterCPUInfoForDeviceLinear4D()),
+            ::testing::Values(fusingFakeQuantizePerChannelRelu),
+            ::testing::ValuesIn(filterAdditionalConfig())),
+    InterpolateLayerCPUTest::getTestCaseName);
+
 const auto interpolateCasesCubic_Smoke = ::testing::Combine(
         ::testing::Values(ngraph::op::v4::Interpolate::InterpolateMode::cubic),
         ::testing::ValuesIn(coordinateTransformModes_Smoke),
@@ -706,6 +774,74 @@ INSTANTIATE_TEST_SUITE_P(InterpolateLinearOnnx5D_Layout_Test, InterpolateLayerCP
             ::testing::ValuesIn(filterAdditionalConfig())),
     InterpolateLayerCPUTest::getTestCaseName);
 
+std::vector<CPUSpecificParams> filterCPUInfoForDeviceLinear5D() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        resCPUParams.push_back(CPUSpecificParams{{nCdhw16c, x, x, x}, {nCdhw16c}, {"ref"}, "ref"});
+        resCPUParams.push_back(CPUSpecificParams{{ndhwc, x, x, x}, {ndhwc}, {"ref"}, "ref"});
+    } else if (InferenceEngine::with_cpu_x86_sse42()) {
+        resCPUParams.push_back(CPUSpecificParams{{nCdhw8c, x, x, x}, {nCdhw8c}, {"ref"}, "ref"});
+        resCPUParams.push_back(CPUSpecificParams{{ndhwc, x, x, x}, {ndhwc}, {"ref"}, "ref"});
+    }
+    resCPUParams.push_back(CPUSpecificParams{{ncdhw, x, x, x}, {ncdhw}, {"ref"}, "ref"});
+    return resCPUParams;
+}
+
+const auto interpolateCasesLinear5D_Smoke = ::testing::Combine(
+        ::testing::Values(ngraph::op::v4::Interpolate::InterpolateMode::linear),
+        ::testing::ValuesIn(coordinateTransformModes_Smoke),
+        ::testing::ValuesIn(defNearestModes),
+        ::testing::ValuesIn(antialias),
+        ::testing::ValuesIn(pads5D),
+        ::testing::ValuesIn(pads5D),
+        ::testing::ValuesIn(cubeCoefs));
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterpolateLinear5D_Layout_Test, InterpolateLayerCPUTest,
+        ::testing::Combine(
+            interpolateCasesLinear5D_Smoke,
+            ::testing::ValuesIn(shapeParams5D_Smoke),
+            ::testing::Values(ElementType::f32),
+            ::testing::ValuesIn(filterCPUInfoForDeviceLinear5D()),
+            ::testing::Values(emptyFusingSpec),
+            ::testing::ValuesIn(filterAdditionalConfig())),
+    InterpolateLayerCPUTest::getTestCaseName);
+
+const std::vector<ShapeParams> shapeParams5D_Downscale = {
+    ShapeParams{
+        ngraph::op::v4::Interpolate::ShapeCalcMode::SCALES,
+        InputShape{{}, {{1, 11, 8, 8, 8}}},
+        ngraph::helpers::InputLayerType::CONSTANT,
+        {{1.f, 1.f, 0.5f, 0.75f, 1.25f}},
+        defaultAxes5D.front()
+    },
+    ShapeParams{
+        ngraph::op::v4::Interpolate::ShapeCalcMode::SIZES,
+        InputShape{{-1, {2, 20}, -1, -1, -1}, {{1, 11, 8, 8, 8}, {2, 7, 6, 12, 10}, {1, 11, 8, 8, 8}}},
+        ngraph::helpers::InputLayerType::PARAMETER,
+        {{1, 11, 3, 6, 5}, {2, 7, 6, 5, 4}, {1, 11, 3, 6, 5}},
+        defaultAxes5D.front()
+    },
+};
+
+const auto interpolateCasesLinearAntialias5D_Smoke = ::testing::Combine(
+        ::testing::Values(ngraph::op::v4::Interpolate::InterpolateMode::linear),
+        ::testing::ValuesIn(coordinateTransformModes_Smoke),
+        ::testing::ValuesIn(defNearestModes),
+        ::testing::Values(true),
+        ::testing::ValuesIn(pads5D),
+        ::testing::ValuesIn(pads5D),
+        ::testing::ValuesIn(cubeCoefs));
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterpolateLinearAntialias5D_Layout_Test, InterpolateLayerCPUTest,
+        ::testing::Combine(
+            interpolateCasesLinearAntialias5D_Smoke,
+            ::testing::ValuesIn(shapeParams5D_Downscale),
+            ::testing::Values(ElementType::f32),
+            ::testing::ValuesIn(filterCPUInfoForDeviceLinear5D()),
+            ::testing::Values(emptyFusingSpec),
+            ::testing::ValuesIn(filterAdditionalConfig())),
+    InterpolateLayerCPUTest::getTestCaseName);
+
 const auto interpolateCasesNN5D_Smoke = ::testing::Combine(
         ::testing::Values(ngraph::op::v4::Interpolate::InterpolateMode::nearest),
         ::testing::ValuesIn(coordinateTransformModes_Smoke),
@@ -452,5 +452,22 @@ std::vector<RDFTTestCPUParams> getParams4D() {
 
 INSTANTIATE_TEST_SUITE_P(smoke_RDFT_CPU_4D, RDFTTestCPU, ::testing::ValuesIn(getParams4D()), RDFTTestCPU::getTestCaseName);
 
+// signal sizes which are not powers of two, long enough to be computed by FFT, including odd inverse ones
+const std::vector<RDFTTestCPUParams> paramsFFT = {
+    {{100}, {0}, {}, false, cpuParams},
+    {{257}, {0}, {}, false, cpuParams},
+    {{480}, {0}, {}, false, cpuParams},
+    {{20, 400}, {0, 1}, {}, false, cpuParams},
+    {{3, 48, 1200}, {2}, {}, false, cpuParams},
+
+    {{51, 2}, {0}, {101}, true, cpuParams},
+    {{241, 2}, {0}, {}, true, cpuParams},
+    {{241, 2}, {0}, {481}, true, cpuParams},
+    {{16, 241, 2}, {0, 1}, {16, 481}, true, cpuParams},
+    {{3, 48, 601, 2}, {2}, {}, true, cpuParams},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_RDFT_CPU_FFT, RDFTTestCPU, ::testing::ValuesIn(paramsFFT), RDFTTestCPU::getTestCaseName);
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
+#include <ie_plugin_config.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+    90% of the FullyConnected weights are zero, so the node packs them as sparse ones if the decompression rate allows.
+    The inputs of up to 16 rows are then executed by the sparse product, which doesn't apply post ops, so Relu must
+    stay a separate node for all shapes. With the sparse weights switched off Relu is fused as usual.
+
+        Param [rows, 64]
+              |
+        MatMul (weights [32, 64], transpose_b) -> Add (bias) -> Relu -> Result
+*/
+using FCSparseWeightsParams = std::tuple<size_t,   // input rows
+                                         float>;   // sparse weights decompression rate
+
+class FCSparseWeightsCPUTest : public testing::WithParamInterface<FCSparseWeightsParams>,
+                               virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCSparseWeightsParams>& obj) {
+        size_t rows;
+        float rate;
+        std::tie(rows, rate) = obj.param;
+        std::ostringstream result;
+        result << "rows=" << rows << "_ratePercent=" << static_cast<int>(rate * 100);
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t inputChannels = 64;
+    static constexpr size_t outputChannels = 32;
+    static constexpr float sparsity = 0.9f;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t rows;
+        std::tie(rows, rate) = this->GetParam();
+        configuration.insert(ov::intel_cpu::sparse_weights_decompression_rate(rate));
+        // the sparse weights are used for fp32 only
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+        expectSparse = rate <= sparsity && rows <= 16;
+
+        init_input_shapes({InputShape{{}, {{rows, inputChannels}}}});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        // every tenth weight is not zero
+        std::vector<float> weights(outputChannels * inputChannels, 0.f);
+        for (size_t i = 0; i < weights.size(); i += 10)
+            weights[i] = static_cast<float>(static_cast<int>(i % 17) - 8) / 8.f;
+        auto weightsConst = ngraph::builder::makeConstant(ov::element::f32, {outputChannels, inputChannels}, weights);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weightsConst, false, true);
+        auto bias = ngraph::builder::makeConstant<float>(ov::element::f32, {1, outputChannels}, {}, true);
+        auto add = std::make_shared<ov::op::v1::Add>(matMul, bias);
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        function = std::make_shared<ov::Model>(ov::NodeVector{relu}, params, "FCSparseWeights");
+    }
+
+    void checkExecGraph() {
+        const auto runtimeModel = compiledModel.get_runtime_model();
+        for (const auto& node : runtimeModel->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto implType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            const std::string suffix = "_sparse";
+            const bool isSparse = implType.size() > suffix.size() &&
+                                  implType.compare(implType.size() - suffix.size(), suffix.size(), suffix) == 0;
+            ASSERT_EQ(expectSparse, isSparse) << "Unexpected implementation type " << implType;
+        }
+        CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+        // Relu is never fused into the node with the sparse weights
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", rate <= sparsity ? 1 : 0);
+    }
+
+    float rate = 1.f;
+    bool expectSparse = false;
+};
+
+TEST_P(FCSparseWeightsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    checkExecGraph();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCSparseWeights, FCSparseWeightsCPUTest,
+                         ::testing::Combine(::testing::Values(1, 5, 16, 33),
+                                            ::testing::Values(0.5f, 0.95f, 1.f)),
+                         FCSparseWeightsCPUTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+    The preprocessing chain built by PrePostProcessor for NV12/I420 inputs
+    (color conversion -> [resize] -> convert to f32 -> mean -> scale -> [NHWC to NCHW]) is fused into a single
+    ImagePreprocess node by the CPU plugin. The results are compared with the reference of the not fused chain.
+*/
+enum class ResizeMode {
+    NONE,
+    LINEAR,
+    NEAREST
+};
+
+std::ostream& operator<<(std::ostream& os, ResizeMode mode) {
+    switch (mode) {
+    case ResizeMode::NONE:
+        return os << "none";
+    case ResizeMode::LINEAR:
+        return os << "linear";
+    case ResizeMode::NEAREST:
+        return os << "nearest";
+    }
+    return os;
+}
+
+using FuseImagePreprocessParams = std::tuple<bool,          // I420, NV12 otherwise
+                                             bool,          // BGR, RGB otherwise
+                                             ResizeMode,    // resize
+                                             ov::Shape,     // resized height and width
+                                             bool>;         // NCHW output, NHWC otherwise
+
+class FuseImagePreprocessTest : public testing::WithParamInterface<FuseImagePreprocessParams>,
+                                virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FuseImagePreprocessParams>& obj) {
+        bool i420, bgr, planar;
+        ResizeMode resize;
+        ov::Shape resizedShape;
+        std::tie(i420, bgr, resize, resizedShape, planar) = obj.param;
+        std::ostringstream result;
+        result << (i420 ? "I420" : "NV12") << "_" << (bgr ? "BGR" : "RGB") << "_resize=" << resize;
+        if (resize != ResizeMode::NONE)
+            result << "_to=" << CommonTestUtils::vec2str(resizedShape);
+        result << "_layout=" << (planar ? "NCHW" : "NHWC");
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t height = 16;
+    static constexpr size_t width = 24;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        bool i420, bgr, planar;
+        ResizeMode resize;
+        ov::Shape resizedShape;
+        std::tie(i420, bgr, resize, resizedShape, planar) = this->GetParam();
+        // the color conversion and the integer resize may deviate by one level each, the scale halves the deviation
+        abs_threshold = 1.f;
+
+        std::vector<ov::Shape> planes{{1, height, width, 1}};
+        if (i420) {
+            planes.push_back({1, height / 2, width / 2, 1});
+            planes.push_back({1, height / 2, width / 2, 1});
+        } else {
+            planes.push_back({1, height / 2, width / 2, 2});
+        }
+        init_input_shapes(static_shapes_to_test_representation(planes));
+        ov::ParameterVector params;
+        for (const auto& plane : planes)
+            params.push_back(std::make_shared<ngraph::opset8::Parameter>(ov::element::u8, plane));
+
+        std::shared_ptr<ov::Node> image;
+        if (i420 && bgr)
+            image = std::make_shared<ngraph::opset8::I420toBGR>(params[0], params[1], params[2]);
+        else if (i420)
+            image = std::make_shared<ngraph::opset8::I420toRGB>(params[0], params[1], params[2]);
+        else if (bgr)
+            image = std::make_shared<ngraph::opset8::NV12toBGR>(params[0], params[1]);
+        else
+            image = std::make_shared<ngraph::opset8::NV12toRGB>(params[0], params[1]);
+
+        if (resize != ResizeMode::NONE) {
+            using Interpolate = ngraph::opset8::Interpolate;
+            Interpolate::InterpolateAttrs attrs(
+                resize == ResizeMode::LINEAR ? Interpolate::InterpolateMode::LINEAR : Interpolate::InterpolateMode::NEAREST,
+                Interpolate::ShapeCalcMode::SIZES, {0, 0, 0, 0}, {0, 0, 0, 0});
+            attrs.coordinate_transformation_mode = Interpolate::CoordinateTransformMode::HALF_PIXEL;
+            attrs.nearest_mode = Interpolate::NearestMode::ROUND_PREFER_FLOOR;
+            auto sizes = ngraph::opset8::Constant::create(ov::element::i64, ov::Shape{2}, resizedShape);
+            auto scales = ngraph::opset8::Constant::create(ov::element::f32, ov::Shape{2},
+                                                           {static_cast<float>(resizedShape[0]) / height,
+                                                            static_cast<float>(resizedShape[1]) / width});
+            auto axes = ngraph::opset8::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+            image = std::make_shared<Interpolate>(image, sizes, scales, axes, attrs);
+        }
+
+        auto convert = std::make_shared<ngraph::opset8::Convert>(image, ov::element::f32);
+        auto mean = std::make_shared<ngraph::opset8::Subtract>(
+            convert, ngraph::opset8::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {123.f, 117.f, 104.f}));
+        std::shared_ptr<ov::Node> result = std::make_shared<ngraph::opset8::Multiply>(
+            mean, ngraph::opset8::Constant::create(ov::element::f32, ov::Shape{1}, {0.5f}));
+        if (planar) {
+            result = std::make_shared<ngraph::opset8::Transpose>(
+                result, ngraph::opset8::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2}));
+        }
+        function = std::make_shared<ov::Model>(ov::NodeVector{result}, params, "FuseImagePreprocess");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& params = function->get_parameters();
+        for (size_t i = 0; i < params.size(); i++) {
+            auto tensor = ov::test::utils::create_and_fill_tensor(params[i]->get_element_type(),
+                                                                  targetInputStaticShapes[i], 255, 0);
+            inputs.insert({params[i], tensor});
+        }
+    }
+};
+
+TEST_P(FuseImagePreprocessTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseImagePreprocess, FuseImagePreprocessTest,
+                         ::testing::Combine(::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(ResizeMode::NONE),
+                                            ::testing::Values(ov::Shape{}),
+                                            ::testing::Bool()),
+                         FuseImagePreprocessTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseImagePreprocessResize, FuseImagePreprocessTest,
+                         ::testing::Combine(::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(ResizeMode::LINEAR, ResizeMode::NEAREST),
+                                            ::testing::Values(ov::Shape{8, 12}, ov::Shape{21, 29}),
+                                            ::testing::Bool()),
+                         FuseImagePreprocessTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
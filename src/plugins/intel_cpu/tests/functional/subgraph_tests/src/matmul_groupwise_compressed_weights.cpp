@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <compress_quantize_weights.hpp>
+#include <ngraph/pass/manager.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+    MatMul with the weights compressed by CompressWeightsGroupwise is inferred by the CPU plugin
+    (u4/i4 Convert -> [Subtract] -> Multiply -> Reshape decompression subgraph) and compared with
+    the original not compressed model. The weights are chosen to be representable in the 4-bit grid
+    of every group exactly, and the inputs are multiples of 1/8, so the results must be equal.
+*/
+using MatMulGroupwiseCompressedWeightsParams = std::tuple<ov::element::Type,  // compressed weights type
+                                                          bool>;              // transpose_b
+
+class MatMulGroupwiseCompressedWeights : public testing::WithParamInterface<MatMulGroupwiseCompressedWeightsParams>,
+                                         virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MatMulGroupwiseCompressedWeightsParams>& obj) {
+        ov::element::Type weightsType;
+        bool transposeB;
+        std::tie(weightsType, transposeB) = obj.param;
+        std::ostringstream result;
+        result << "weights=" << weightsType << "_transposeB=" << transposeB;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t batch = 3;
+    static constexpr size_t inputChannels = 64;
+    static constexpr size_t outputChannels = 16;
+    static constexpr size_t groupSize = 32;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::element::Type weightsType;
+        bool transposeB;
+        std::tie(weightsType, transposeB) = this->GetParam();
+        abs_threshold = 1e-6;
+
+        init_input_shapes({InputShape{{}, {{batch, inputChannels}}}});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+
+        // u4 groups hit both ends of [-7, 8], i4 groups hit both ends of [-7, 7], so the group scale is 2^-(group % 2)
+        const bool isSigned = weightsType == ov::element::i4;
+        const ov::Shape weightsShape = transposeB ? ov::Shape{outputChannels, inputChannels}
+                                                  : ov::Shape{inputChannels, outputChannels};
+        std::vector<float> weights(ov::shape_size(weightsShape));
+        for (size_t o = 0; o < outputChannels; o++) {
+            for (size_t i = 0; i < inputChannels; i++) {
+                const int level = static_cast<int>((i * 7 + o * 3) % (isSigned ? 15 : 16)) - 7;
+                const float scale = (i / groupSize) % 2 ? 0.5f : 1.f;
+                weights[transposeB ? o * inputChannels + i : i * outputChannels + o] = level * scale;
+            }
+        }
+        auto weightsConst = ngraph::builder::makeConstant(ov::element::f32, weightsShape, weights);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weightsConst, false, transposeB);
+        function = std::make_shared<ov::Model>(ov::NodeVector{matMul}, params, "MatMulGroupwiseCompressedWeights");
+        functionRefs = ov::clone_model(*function);
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::CompressWeightsGroupwise>(groupSize, weightsType);
+        manager.run_passes(function);
+
+        bool compressed = false;
+        for (const auto& node : function->get_ordered_ops()) {
+            if (ov::is_type<ov::op::v0::Constant>(node) && node->get_output_element_type(0) == weightsType)
+                compressed = true;
+        }
+        ASSERT_TRUE(compressed) << "Weights were not compressed";
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& param = function->get_parameters()[0];
+        // multiples of 1/8 in [-5, 5)
+        auto tensor = ov::test::utils::create_and_fill_tensor(param->get_element_type(), targetInputStaticShapes[0], 10, -5, 8);
+        inputs.insert({param, tensor});
+    }
+};
+
+TEST_P(MatMulGroupwiseCompressedWeights, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulGroupwiseCompressedWeights, MatMulGroupwiseCompressedWeights,
+                         ::testing::Combine(::testing::Values(ov::element::u4, ov::element::i4),
+                                            ::testing::Values(true, false)),
+                         MatMulGroupwiseCompressedWeights::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
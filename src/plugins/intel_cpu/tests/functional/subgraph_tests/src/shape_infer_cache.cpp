@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+    Reshape and Tile take the target shape and the repeats from parameters, so their shape inference depends both on
+    the input shapes and on the input values. The inputs are switched between a few configurations, so that the
+    repeated ones are served by the shape inference results cached in the runtime cache, while the ones with the same
+    shapes but other values must not be.
+
+        Param(data) [-1, -1]   Param(shape) [2]
+                 \             /
+                   Reshape         Param(repeats) [2]
+                        \          /
+                           Tile
+                            |
+                          Result
+*/
+struct ShapeInferCacheStep {
+    ov::Shape dataShape;
+    std::vector<int32_t> targetShape;
+    std::vector<int32_t> repeats;
+};
+
+using ShapeInferCacheParams = std::string;  // runtime cache capacity
+
+class ShapeInferCacheCPUTest : public testing::WithParamInterface<ShapeInferCacheParams>,
+                               virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ShapeInferCacheParams>& obj) {
+        return "cacheCapacity=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, GetParam()});
+
+        auto data = std::make_shared<ngraph::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, -1});
+        auto shape = std::make_shared<ngraph::opset8::Parameter>(ov::element::i32, ov::PartialShape{2});
+        auto repeats = std::make_shared<ngraph::opset8::Parameter>(ov::element::i32, ov::PartialShape{2});
+        auto reshape = std::make_shared<ngraph::opset8::Reshape>(data, shape, false);
+        auto tile = std::make_shared<ngraph::opset8::Tile>(reshape, repeats);
+        function = std::make_shared<ov::Model>(ov::NodeVector{tile}, ov::ParameterVector{data, shape, repeats},
+                                               "ShapeInferCache");
+    }
+
+    void set_inputs(const ShapeInferCacheStep& step) {
+        const auto& params = function->get_parameters();
+        ov::Tensor data{ov::element::f32, step.dataShape};
+        auto dataPtr = data.data<float>();
+        for (size_t i = 0; i < data.get_size(); i++)
+            dataPtr[i] = static_cast<float>(i);
+        ov::Tensor shape{ov::element::i32, {2}};
+        std::copy(step.targetShape.begin(), step.targetShape.end(), shape.data<int32_t>());
+        ov::Tensor repeats{ov::element::i32, {2}};
+        std::copy(step.repeats.begin(), step.repeats.end(), repeats.data<int32_t>());
+        inferRequest.set_tensor(params[0], data);
+        inferRequest.set_tensor(params[1], shape);
+        inferRequest.set_tensor(params[2], repeats);
+    }
+
+    void check_output(const ShapeInferCacheStep& step) {
+        const size_t rows = step.targetShape[0], columns = step.targetShape[1];
+        const ov::Shape expectedShape{rows * step.repeats[0], columns * step.repeats[1]};
+        const auto output = inferRequest.get_output_tensor(0);
+        ASSERT_EQ(expectedShape, output.get_shape());
+        const auto outputPtr = output.data<float>();
+        for (size_t i = 0; i < expectedShape[0]; i++) {
+            for (size_t j = 0; j < expectedShape[1]; j++) {
+                ASSERT_EQ(static_cast<float>((i % rows) * columns + j % columns), outputPtr[i * expectedShape[1] + j])
+                    << "at [" << i << ", " << j << "]";
+            }
+        }
+    }
+
+    const std::vector<ShapeInferCacheStep> steps = {
+        {{2, 6}, {3, 4}, {1, 2}},
+        {{4, 3}, {6, 2}, {2, 1}},
+        {{2, 6}, {3, 4}, {1, 2}},   // same as the first one
+        {{2, 6}, {4, 3}, {1, 2}},   // same shapes, other target shape value
+        {{2, 6}, {3, 4}, {2, 2}},   // same shapes, other repeats value
+        {{4, 3}, {6, 2}, {2, 1}},   // same as the second one
+        {{2, 6}, {4, 3}, {1, 2}},
+        {{2, 6}, {3, 4}, {1, 2}},
+    };
+};
+
+TEST_P(ShapeInferCacheCPUTest, OutputShapesFollowInputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+    for (size_t i = 0; i < steps.size(); i++) {
+        SCOPED_TRACE("step " + std::to_string(i));
+        set_inputs(steps[i]);
+        inferRequest.infer();
+        check_output(steps[i]);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapeInferCache, ShapeInferCacheCPUTest,
+                         ::testing::Values("0", "5000"),
+                         ShapeInferCacheCPUTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include <openvino/runtime/properties.hpp>
+#include <chrono>
+#include <numeric>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+    A static graph of the tiny nodes, where the per node overhead of Graph::Infer dominates the compute.
+    The graph is executed through the compiled execution plan by default, and through the generic node loop
+    when the performance counters are collected. Both must produce the same results, the per node time of
+    both is printed.
+
+        Param [1, 8] -> 64 x MatMul (weights [8, 8], cyclic shift of the elements) -> Result
+*/
+class StaticGraphExecutionPlanCPUTest : public ::testing::Test {
+protected:
+    static constexpr size_t nodesNum = 64;
+    static constexpr size_t channels = 8;
+    static constexpr size_t iterations = 1000;
+
+    static std::shared_ptr<ov::Model> createModel() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, channels});
+        std::vector<float> weights(channels * channels, 0.f);
+        for (size_t i = 0; i < channels; i++)
+            weights[i * channels + (i + 1) % channels] = 1.f;
+
+        std::shared_ptr<ov::Node> last = param;
+        for (size_t i = 0; i < nodesNum; i++) {
+            auto weightsConst = ngraph::builder::makeConstant(ov::element::f32, {channels, channels}, weights);
+            last = std::make_shared<ov::op::v0::MatMul>(last, weightsConst, false, true);
+        }
+        return std::make_shared<ov::Model>(ov::NodeVector{last}, ov::ParameterVector{param}, "StaticGraphExecutionPlan");
+    }
+
+    // returns the average time of the node execution in nanoseconds
+    static double run(ov::InferRequest& request, const std::vector<float>& input, std::vector<float>& output) {
+        std::copy(input.begin(), input.end(), request.get_input_tensor().data<float>());
+        for (size_t i = 0; i < 10; i++)
+            request.infer();
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            request.infer();
+        auto finish = std::chrono::steady_clock::now();
+
+        const auto outputTensor = request.get_output_tensor();
+        output.assign(outputTensor.data<float>(), outputTensor.data<float>() + outputTensor.get_size());
+        return std::chrono::duration<double, std::nano>(finish - start).count() / iterations / nodesNum;
+    }
+};
+
+TEST_F(StaticGraphExecutionPlanCPUTest, CompareWithNodeLoop) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto core = ov::test::utils::PluginCache::get().core();
+    const auto model = createModel();
+
+    auto planModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    auto loopModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU, ov::enable_profiling(true));
+    CheckNumberOfNodesWithType(planModel, "FullyConnected", nodesNum);
+
+    std::vector<float> input(channels);
+    std::iota(input.begin(), input.end(), 1.f);
+    std::vector<float> planOutput, loopOutput;
+
+    auto planRequest = planModel.create_infer_request();
+    auto loopRequest = loopModel.create_infer_request();
+    const double planTime = run(planRequest, input, planOutput);
+    const double loopTime = run(loopRequest, input, loopOutput);
+
+    std::cout << "Per node time of the static graph: execution plan " << planTime << " ns, "
+              << "node loop with the performance counters " << loopTime << " ns" << std::endl;
+
+    // the number of the shifts is a multiple of the channels, so the graph is an identity
+    ASSERT_EQ(input, planOutput);
+    ASSERT_EQ(planOutput, loopOutput);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph_transformations/fuse_image_preprocess.hpp>
+#include <ngraph_transformations/op/image_preprocess.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::shared_ptr<ngraph::Node> makeResize(const ngraph::Output<ngraph::Node>& input,
+                                         ngraph::opset8::Interpolate::InterpolateMode mode,
+                                         ngraph::opset8::Interpolate::ShapeCalcMode shapeCalcMode,
+                                         bool withAxes) {
+    ngraph::opset8::Interpolate::InterpolateAttrs attrs(mode, shapeCalcMode, {0, 0, 0, 0}, {0, 0, 0, 0});
+    if (!withAxes) {
+        auto sizes = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {1, 4, 6, 3});
+        auto scales = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {1.f, 0.5f, 0.5f, 1.f});
+        return std::make_shared<ngraph::opset8::Interpolate>(input, sizes, scales, attrs);
+    }
+    auto sizes = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {4, 6});
+    auto scales = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {0.5f, 0.5f});
+    auto axes = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 2});
+    return std::make_shared<ngraph::opset8::Interpolate>(input, sizes, scales, axes, attrs);
+}
+
+std::shared_ptr<ngraph::Function> makeNV12Preprocessing(
+        ngraph::opset8::Interpolate::InterpolateMode mode,
+        ngraph::opset8::Interpolate::ShapeCalcMode shapeCalcMode = ngraph::opset8::Interpolate::ShapeCalcMode::SIZES,
+        bool withAxes = true) {
+    auto y = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, 8, 12, 1});
+    auto uv = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, 4, 6, 2});
+    auto bgr = std::make_shared<ngraph::opset8::NV12toBGR>(y, uv);
+    auto resize = makeResize(bgr, mode, shapeCalcMode, withAxes);
+    auto convert = std::make_shared<ngraph::opset8::Convert>(resize, ngraph::element::f32);
+    auto mean = std::make_shared<ngraph::opset8::Subtract>(
+        convert, ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, {1.f, 2.f, 3.f}));
+    auto scale = std::make_shared<ngraph::opset8::Divide>(
+        mean, ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {2.f}));
+    auto transpose = std::make_shared<ngraph::opset8::Transpose>(
+        scale, ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 3, 1, 2}));
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{transpose}, ngraph::ParameterVector{y, uv});
+}
+
+}   // namespace
+
+TEST(TransformationTests, FuseImagePreprocessNV12) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        f = makeNV12Preprocessing(ngraph::opset8::Interpolate::InterpolateMode::LINEAR);
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FuseImagePreprocess>();
+        m.run_passes(f);
+    }
+
+    {
+        auto y = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, 8, 12, 1});
+        auto uv = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, 4, 6, 2});
+        ImagePreprocessNode::Attributes attrs;
+        attrs.bgr = true;
+        attrs.out_height = 4;
+        attrs.out_width = 6;
+        attrs.round_resized = true;
+        attrs.scale = {0.5f, 0.5f, 0.5f};
+        attrs.shift = {-0.5f, -1.f, -1.5f};
+        attrs.planar = true;
+        auto preprocess = std::make_shared<ImagePreprocessNode>(ngraph::OutputVector{y, uv}, attrs);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{preprocess}, ngraph::ParameterVector{y, uv});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    const auto fused = ov::as_type_ptr<ImagePreprocessNode>(f->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, fused);
+    ASSERT_EQ((std::vector<float>{-0.5f, -1.f, -1.5f}), fused->get_attrs().shift);
+}
+
+TEST(TransformationTests, FuseImagePreprocessCubicResizeIsNotFused) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        f = makeNV12Preprocessing(ngraph::opset8::Interpolate::InterpolateMode::CUBIC);
+        f_ref = makeNV12Preprocessing(ngraph::opset8::Interpolate::InterpolateMode::CUBIC);
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FuseImagePreprocess>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FuseImagePreprocessScalesResizeIsNotFused) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        f = makeNV12Preprocessing(ngraph::opset8::Interpolate::InterpolateMode::LINEAR,
+                                  ngraph::opset8::Interpolate::ShapeCalcMode::SCALES);
+        f_ref = makeNV12Preprocessing(ngraph::opset8::Interpolate::InterpolateMode::LINEAR,
+                                      ngraph::opset8::Interpolate::ShapeCalcMode::SCALES);
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FuseImagePreprocess>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FuseImagePreprocessResizeWithoutAxes) {
+    auto f = makeNV12Preprocessing(ngraph::opset8::Interpolate::InterpolateMode::LINEAR,
+                                   ngraph::opset8::Interpolate::ShapeCalcMode::SIZES,
+                                   false);
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<FuseImagePreprocess>();
+    m.run_passes(f);
+
+    const auto fused = ov::as_type_ptr<ImagePreprocessNode>(f->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, fused);
+    ASSERT_EQ(4, fused->get_attrs().out_height);
+    ASSERT_EQ(6, fused->get_attrs().out_width);
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common/nms_utils.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// boxes are [min0, min1, max0, max1]
+float positiveIoU(const float* a, const float* b, float offset) {
+    const float side0 = std::min(a[2], b[2]) - std::max(a[0], b[0]) + offset;
+    const float side1 = std::min(a[3], b[3]) - std::max(a[1], b[1]) + offset;
+    if (side0 <= 0.f || side1 <= 0.f)
+        return 0.f;
+    const float areaA = (a[2] - a[0] + offset) * (a[3] - a[1] + offset);
+    const float areaB = (b[2] - b[0] + offset) * (b[3] - b[1] + offset);
+    return side0 * side1 / (areaA + areaB - side0 * side1);
+}
+
+float area(const float* box, float offset) {
+    return (box[2] - box[0] + offset) * (box[3] - box[1] + offset);
+}
+
+}   // namespace
+
+TEST(NmsUtilsTest, FilterByScore) {
+    std::vector<float> scores(200, 0.1f);
+    scores[3] = 0.5f;
+    scores[64] = 0.7f;
+    scores[199] = 0.6f;
+    std::vector<int> indices(scores.size());
+
+    ASSERT_EQ(2u, filterByScore(scores.data(), scores.size(), 0.5f, false, indices.data()));
+    ASSERT_EQ(64, indices[0]);
+    ASSERT_EQ(199, indices[1]);
+
+    ASSERT_EQ(3u, filterByScore(scores.data(), scores.size(), 0.5f, true, indices.data()));
+    ASSERT_EQ((std::vector<int>{3, 64, 199}), std::vector<int>(indices.begin(), indices.begin() + 3));
+
+    ASSERT_EQ(0u, filterByScore(scores.data(), scores.size(), 0.9f, true, indices.data()));
+}
+
+TEST(NmsUtilsTest, TopKByScoreOrdersTiesByIndex) {
+    const std::vector<float> scores{0.2f, 0.9f, 0.5f, 0.9f, 0.1f, 0.5f};
+    std::vector<int> indices{5, 4, 3, 2, 1, 0};
+
+    ASSERT_EQ(3u, topKByScore(indices.data(), indices.size(), 3, scores.data()));
+    ASSERT_EQ((std::vector<int>{1, 3, 2}), std::vector<int>(indices.begin(), indices.begin() + 3));
+
+    ASSERT_EQ(6u, topKByScore(indices.data(), indices.size(), 10, scores.data()));
+    ASSERT_EQ((std::vector<int>{1, 3, 2, 5, 0, 4}), indices);
+}
+
+TEST(NmsUtilsTest, PositiveOverlapMatchesScalarIoU) {
+    std::vector<float> boxes;
+    for (int i = 0; i < 150; i++) {
+        const float min0 = static_cast<float>(i % 13);
+        const float min1 = static_cast<float>(i % 7) * 0.5f;
+        boxes.insert(boxes.end(), {min0, min1, min0 + static_cast<float>(i % 5), min1 + static_cast<float>(i % 3) + 0.5f});
+    }
+    const size_t count = boxes.size() / 4;
+
+    for (float offset : {0.f, 1.f}) {
+        NmsBoxes stored(NmsBoxes::Overlap::Positive, offset);
+        for (size_t j = 0; j < count; j++)
+            stored.push_back(&boxes[j * 4], area(&boxes[j * 4], offset));
+        ASSERT_EQ(count, stored.size());
+
+        std::vector<float> iou(count);
+        for (size_t i = 0; i < count; i++) {
+            const float* box = &boxes[i * 4];
+            stored.iou(box, area(box, offset), count, iou.data());
+            float maxIoU = 0.f;
+            for (size_t j = 0; j < count; j++) {
+                ASSERT_EQ(positiveIoU(box, &boxes[j * 4], offset), iou[j]) << i << " " << j;
+                maxIoU = std::max(maxIoU, iou[j]);
+            }
+            ASSERT_TRUE(stored.suppresses(box, area(box, offset), maxIoU, true));
+            ASSERT_FALSE(stored.suppresses(box, area(box, offset), maxIoU, false));
+        }
+    }
+}
+
+TEST(NmsUtilsTest, TouchingOverlap) {
+    const std::vector<float> a{0.f, 0.f, 1.f, 1.f};
+    const std::vector<float> b{1.f, 0.f, 2.f, 1.f};
+    const std::vector<float> c{1.5f, 0.f, 2.f, 1.f};
+    float iou = -1.f;
+
+    NmsBoxes touching(NmsBoxes::Overlap::Touching, 1.f);
+    touching.push_back(b.data(), area(b.data(), 1.f));
+    touching.iou(a.data(), area(a.data(), 1.f), 1, &iou);
+    ASSERT_FLOAT_EQ(2.f / 6.f, iou);
+
+    NmsBoxes positive(NmsBoxes::Overlap::Positive, 0.f);
+    positive.push_back(b.data(), area(b.data(), 0.f));
+    positive.iou(a.data(), area(a.data(), 0.f), 1, &iou);
+    ASSERT_EQ(0.f, iou);
+
+    // separated boxes do not intersect even if the offset makes the intersection sides positive
+    touching.clear();
+    touching.push_back(c.data(), area(c.data(), 1.f));
+    touching.iou(a.data(), area(a.data(), 1.f), 1, &iou);
+    ASSERT_EQ(0.f, iou);
+}
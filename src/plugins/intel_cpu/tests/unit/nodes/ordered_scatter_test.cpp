@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common/ordered_scatter.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<uint8_t> sequentialScatter(std::vector<uint8_t> dst, const std::vector<uint8_t>& update,
+                                       const std::vector<size_t>& dstOffsets, size_t blockSize) {
+    const size_t dstBlocks = dst.size() / blockSize;
+    for (size_t t = 0; t < dstOffsets.size(); t++) {
+        if (dstOffsets[t] < dstBlocks)
+            std::memcpy(&dst[dstOffsets[t] * blockSize], &update[t * blockSize], blockSize);
+    }
+    return dst;
+}
+
+}   // namespace
+
+TEST(OrderedScatterTest, LastDuplicateWins) {
+    for (size_t blockSize : {1, 4, 12}) {
+        const size_t dstBlocks = 37;
+        std::vector<uint8_t> dst(dstBlocks * blockSize);
+        for (size_t i = 0; i < dst.size(); i++)
+            dst[i] = static_cast<uint8_t>(i * 7);
+
+        std::vector<size_t> dstOffsets;
+        for (size_t t = 0; t < 500; t++)
+            dstOffsets.push_back((t * t * 13 + 5) % (dstBlocks / 2));
+        // out of range offsets are skipped
+        dstOffsets[10] = dstBlocks;
+        dstOffsets[11] = static_cast<size_t>(-1);
+        std::vector<uint8_t> update(dstOffsets.size() * blockSize);
+        for (size_t i = 0; i < update.size(); i++)
+            update[i] = static_cast<uint8_t>(i * 3 + 1);
+
+        const auto expected = sequentialScatter(dst, update, dstOffsets, blockSize);
+        scatterBlocks(dst.data(), dstBlocks, update.data(), dstOffsets.data(), dstOffsets.size(), blockSize);
+        ASSERT_EQ(expected, dst) << blockSize;
+    }
+}
+
+TEST(OrderedScatterTest, FewUpdates) {
+    std::vector<uint8_t> dst(1000, 0);
+    const std::vector<uint8_t> update{1, 2, 3};
+    const std::vector<size_t> dstOffsets{999, 0, 999};
+
+    scatterBlocks(dst.data(), dst.size(), update.data(), dstOffsets.data(), dstOffsets.size(), 1);
+    ASSERT_EQ(2, dst[0]);
+    ASSERT_EQ(3, dst[999]);
+    ASSERT_EQ(0, dst[500]);
+}
+
+TEST(OrderedScatterTest, SkewedOffsets) {
+    const size_t dstBlocks = 10000;
+    std::vector<uint8_t> dst(dstBlocks * 4, 0);
+    // most of the updates, including all the duplicates, fall into a few blocks in the middle
+    std::vector<size_t> dstOffsets;
+    for (size_t t = 0; t < 20000; t++)
+        dstOffsets.push_back(t % 10 ? dstBlocks / 2 + t % 7 : (t * 31) % dstBlocks);
+    std::vector<uint8_t> update(dstOffsets.size() * 4);
+    for (size_t i = 0; i < update.size(); i++)
+        update[i] = static_cast<uint8_t>(i * 5 + 3);
+
+    const auto expected = sequentialScatter(dst, update, dstOffsets, 4);
+    scatterBlocks(dst.data(), dstBlocks, update.data(), dstOffsets.data(), dstOffsets.size(), 4);
+    ASSERT_EQ(expected, dst);
+}
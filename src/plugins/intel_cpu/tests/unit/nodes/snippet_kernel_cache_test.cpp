@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common/snippet_kernel_cache.h>
+
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct TestKernel {
+    int id;
+};
+
+// Subgraph (in0 + in1) * in1 with the given node names
+std::shared_ptr<ngraph::snippets::op::Subgraph> makeSnippet(const std::string& name, bool multiply = true) {
+    const ov::Shape shape{1, 3, 16, 16};
+    auto data0 = std::make_shared<ngraph::opset1::Parameter>(ov::element::f32, shape);
+    auto data1 = std::make_shared<ngraph::opset1::Parameter>(ov::element::f32, shape);
+    auto in0 = std::make_shared<ngraph::opset1::Parameter>(ov::element::f32, shape);
+    auto in1 = std::make_shared<ngraph::opset1::Parameter>(ov::element::f32, shape);
+    auto add = std::make_shared<ngraph::opset1::Add>(in0, in1);
+    add->set_friendly_name(name + "_add");
+    std::shared_ptr<ov::Node> out;
+    if (multiply)
+        out = std::make_shared<ngraph::opset1::Multiply>(add, in1);
+    else
+        out = std::make_shared<ngraph::opset1::Subtract>(add, in1);
+    out->set_friendly_name(name + "_out");
+    auto body = std::make_shared<ov::Model>(ov::NodeVector{out}, ov::ParameterVector{in0, in1}, name + "_body");
+    auto snippet = std::make_shared<ngraph::snippets::op::Subgraph>(ov::OutputVector{data0, data1}, body);
+    snippet->set_friendly_name(name);
+    return snippet;
+}
+
+SharedKernelKey makeKey(const ngraph::snippets::op::Subgraph& snippet) {
+    SharedKernelKey key = {"", {false, false, false}, 3, 0};
+    EXPECT_TRUE(getSnippetBodySignature(snippet, key.bodySignature));
+    return key;
+}
+
+}   // namespace
+
+TEST(SnippetKernelCacheTest, SignatureIgnoresNames) {
+    std::string first, second, other;
+    ASSERT_TRUE(getSnippetBodySignature(*makeSnippet("first"), first));
+    ASSERT_TRUE(getSnippetBodySignature(*makeSnippet("second"), second));
+    ASSERT_TRUE(getSnippetBodySignature(*makeSnippet("other", false), other));
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+}
+
+TEST(SnippetKernelCacheTest, HitAndMiss) {
+    SharedKernelCache<TestKernel> cache;
+    const auto key = makeKey(*makeSnippet("snippet"));
+    int built = 0;
+    auto builder = [&built]() {
+        return std::make_shared<TestKernel>(TestKernel{built++});
+    };
+
+    auto kernel = cache.getOrCreate(key, builder);
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(0u, statistics.hits);
+    ASSERT_EQ(1u, statistics.misses);
+    ASSERT_EQ(1u, statistics.size);
+
+    ASSERT_EQ(kernel, cache.getOrCreate(key, builder));
+    statistics = cache.getStatistics();
+    ASSERT_EQ(1u, statistics.hits);
+    ASSERT_EQ(1u, statistics.misses);
+
+    // other broadcasting pattern or isa needs another kernel
+    auto otherKey = key;
+    otherKey.broadcastingPattern[1] = true;
+    ASSERT_NE(kernel, cache.getOrCreate(otherKey, builder));
+    otherKey = key;
+    otherKey.isa = 1;
+    ASSERT_NE(kernel, cache.getOrCreate(otherKey, builder));
+    ASSERT_EQ(3, built);
+
+    // only weak references are stored, so the released kernel is generated again
+    kernel.reset();
+    ASSERT_EQ(0u, cache.getStatistics().size);
+    kernel = cache.getOrCreate(key, builder);
+    ASSERT_EQ(4, built);
+    ASSERT_EQ(4u, cache.getStatistics().misses);
+}
+
+TEST(SnippetKernelCacheTest, IdenticalSubgraphsShareKernel) {
+    SharedKernelCache<TestKernel> cache;
+    int built = 0;
+    auto builder = [&built]() {
+        return std::make_shared<TestKernel>(TestKernel{built++});
+    };
+
+    auto first = cache.getOrCreate(makeKey(*makeSnippet("block0")), builder);
+    auto second = cache.getOrCreate(makeKey(*makeSnippet("block1")), builder);
+    auto other = cache.getOrCreate(makeKey(*makeSnippet("block2", false)), builder);
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(2, built);
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(1u, statistics.hits);
+    ASSERT_EQ(2u, statistics.misses);
+    ASSERT_EQ(2u, statistics.size);
+}
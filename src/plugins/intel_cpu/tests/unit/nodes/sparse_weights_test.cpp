@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common/sparse_weights.h>
+
+#include <random>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<float> randomWeights(size_t size, float sparsity, std::mt19937& gen) {
+    std::uniform_real_distribution<float> value(-1.f, 1.f);
+    std::uniform_real_distribution<float> zero(0.f, 1.f);
+    std::vector<float> weights(size);
+    for (auto& w : weights)
+        w = zero(gen) < sparsity ? 0.f : value(gen);
+    return weights;
+}
+
+}   // namespace
+
+TEST(SparseWeightsTest, Sparsity) {
+    const std::vector<float> weights{0.f, 1.f, 0.f, -2.f, 0.f, 0.f, 3.f, 0.f};
+    ASSERT_FLOAT_EQ(0.625f, SparseWeights::sparsity(weights.data(), weights.size()));
+
+    SparseWeights sparse(weights.data(), 2, 4);
+    ASSERT_EQ(3u, sparse.nonZeros());
+}
+
+TEST(SparseWeightsTest, MatchesDenseProduct) {
+    const size_t OC = 37, IC = 53;
+    std::mt19937 gen(42);
+    const auto weights = randomWeights(OC * IC, 0.8f, gen);
+    const auto bias = randomWeights(OC, 0.f, gen);
+    SparseWeights sparse(weights.data(), OC, IC);
+
+    // single row, several rows and several chunks of rows
+    for (size_t M : {size_t(1), size_t(5), SparseWeights::MAX_ROWS_CHUNK * 2 + 3}) {
+        const auto src = randomWeights(M * IC, 0.f, gen);
+        std::vector<float> dst(M * OC);
+        std::vector<float> scratch(sparse.scratchSize(M));
+        sparse.execute(src.data(), bias.data(), dst.data(), M, scratch.data());
+
+        for (size_t m = 0; m < M; m++) {
+            for (size_t oc = 0; oc < OC; oc++) {
+                float expected = bias[oc];
+                for (size_t ic = 0; ic < IC; ic++)
+                    expected += src[m * IC + ic] * weights[oc * IC + ic];
+                ASSERT_NEAR(expected, dst[m * OC + oc], 1e-4f) << M << " " << m << " " << oc;
+            }
+        }
+    }
+}
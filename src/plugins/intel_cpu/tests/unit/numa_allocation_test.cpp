@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include <cpu_memory.h>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+size_t pageSize() {
+#if defined(__linux__)
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 4096;
+#endif
+}
+
+}   // namespace
+
+TEST(NumaAllocationScopeTest, Nesting) {
+    ASSERT_EQ(-1, NumaAllocationScope::getCurrentNumaNodeId());
+    {
+        NumaAllocationScope outer(0);
+        ASSERT_EQ(0, NumaAllocationScope::getCurrentNumaNodeId());
+        {
+            // negative id keeps the node of the enclosing scope
+            NumaAllocationScope nested(-1);
+            ASSERT_EQ(0, NumaAllocationScope::getCurrentNumaNodeId());
+        }
+        {
+            NumaAllocationScope nested(1);
+            ASSERT_EQ(1, NumaAllocationScope::getCurrentNumaNodeId());
+        }
+        ASSERT_EQ(0, NumaAllocationScope::getCurrentNumaNodeId());
+    }
+    ASSERT_EQ(-1, NumaAllocationScope::getCurrentNumaNodeId());
+}
+
+TEST(NumaAllocationScopeTest, NoBindingOutsideScope) {
+    const auto before = NumaAllocationScope::getStatistics();
+    MemoryMngrWithReuse mngr;
+    ASSERT_TRUE(mngr.resize(4 * pageSize()));
+    ASSERT_EQ(before.boundBytes, NumaAllocationScope::getStatistics().boundBytes);
+}
+
+TEST(NumaAllocationScopeTest, SmallBuffersAreNotBound) {
+    NumaAllocationScope scope(0);
+    const auto before = NumaAllocationScope::getStatistics();
+    MemoryMngrWithReuse mngr;
+    ASSERT_TRUE(mngr.resize(pageSize() / 2));
+    ASSERT_EQ(before.boundBytes, NumaAllocationScope::getStatistics().boundBytes);
+}
+
+TEST(NumaAllocationScopeTest, BoundBufferOwnsWholePages) {
+    const size_t page = pageSize();
+    NumaAllocationScope scope(0);
+    const auto before = NumaAllocationScope::getStatistics();
+
+    MemoryMngrWithReuse mngr;
+    ASSERT_TRUE(mngr.resize(page + 1));
+    auto ptr = static_cast<uint8_t*>(mngr.getRawPtr());
+    ASSERT_NE(nullptr, ptr);
+    // the binding must not cover the pages shared with the other heap objects
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % page);
+    ptr[0] = 1;
+    ptr[page] = 2;
+
+    const auto boundBytes = NumaAllocationScope::getStatistics().boundBytes - before.boundBytes;
+    if (boundBytes == 0)
+        GTEST_SKIP() << "NUMA binding is not available";
+    ASSERT_EQ(2 * page, boundBytes);
+}
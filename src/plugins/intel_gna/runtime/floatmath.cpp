@@ -1,14 +1,109 @@
 // Copyright (C) 2018-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines (for reference)
 //
 
 #include <cstdint>
 #include <cstdio>
 
+#include <ie_parallel.hpp>
+
 #include "floatmath.h"
 
+namespace {
+// the rows are processed in parallel only when there is enough work to amortize the threading overhead
+constexpr size_t kMinParallelWork = 1 << 16;
+// number of the rows of A computed together when B has only a few columns
+constexpr MKL_INT kRowBlock = 4;
+// below this number of the columns of B the loop over them is too short to be vectorized
+constexpr MKL_INT kMinVectorColumns = 8;
+
+// C = A[rows] * B + beta * C for not transposed row major A and B, where beta is either 0 or 1 and alpha
+// is not applied, as in the other not transposed cases. The rows of A are taken from OutputList if it is given.
+// Every output element is accumulated over k in the same order as in the naive loop, so the results are
+// bit exact with it. With enough columns each row of A is read once for all the columns of B and the inner
+// loop over the columns is vectorized. Otherwise (typically a single column) kRowBlock rows are computed
+// together, each with its own accumulator, so the loop over k is vectorized across the rows of the block
+// (one vector lane per row) without changing the summation order.
+void sgemm_nn_rows(const MKL_INT N, const MKL_INT K, const float *A, const MKL_INT lda,
+                   const float *B, const MKL_INT ldb, const float beta, float *C, const MKL_INT ldc,
+                   const uint32_t *OutputList, const MKL_INT L) {
+    if (L <= 0 || N <= 0) {
+        return;
+    }
+    auto row_ptr = [&](MKL_INT l) {
+        const MKL_INT i = OutputList ? static_cast<MKL_INT>(OutputList[l]) : l;
+        return A + static_cast<size_t>(i) * lda;
+    };
+    auto compute_row = [&](MKL_INT l) {
+        const float *a = row_ptr(l);
+        float *c = C + static_cast<size_t>(l) * ldc;
+        if (beta != 1.0) {
+            for (MKL_INT j = 0; j < N; j++) {
+                c[j] = 0;
+            }
+        }
+        for (MKL_INT k = 0; k < K; k++) {
+            const float a_k = a[k];
+            const float *b = B + static_cast<size_t>(k) * ldb;
+            for (MKL_INT j = 0; j < N; j++) {
+                c[j] += a_k * b[j];
+            }
+        }
+    };
+    auto compute_block = [&](MKL_INT l0) {
+        if (l0 + kRowBlock > L) {
+            for (MKL_INT l = l0; l < L; l++) {
+                compute_row(l);
+            }
+            return;
+        }
+        const float *a[kRowBlock];
+        for (MKL_INT r = 0; r < kRowBlock; r++) {
+            a[r] = row_ptr(l0 + r);
+        }
+        for (MKL_INT j = 0; j < N; j++) {
+            float acc[kRowBlock];
+            for (MKL_INT r = 0; r < kRowBlock; r++) {
+                acc[r] = (beta == 1.0) ? C[static_cast<size_t>(l0 + r) * ldc + j] : 0;
+            }
+            for (MKL_INT k = 0; k < K; k++) {
+                const float b_kj = B[static_cast<size_t>(k) * ldb + j];
+                for (MKL_INT r = 0; r < kRowBlock; r++) {
+                    acc[r] += a[r][k] * b_kj;
+                }
+            }
+            for (MKL_INT r = 0; r < kRowBlock; r++) {
+                C[static_cast<size_t>(l0 + r) * ldc + j] = acc[r];
+            }
+        }
+    };
+
+    const bool parallel = static_cast<size_t>(L) * N * K >= kMinParallelWork;
+    if (N >= kMinVectorColumns) {
+        if (parallel) {
+            InferenceEngine::parallel_for(L, compute_row);
+        } else {
+            for (MKL_INT l = 0; l < L; l++) {
+                compute_row(l);
+            }
+        }
+        return;
+    }
+    const MKL_INT blocks = (L + kRowBlock - 1) / kRowBlock;
+    if (parallel) {
+        InferenceEngine::parallel_for(blocks, [&](MKL_INT b) {
+            compute_block(b * kRowBlock);
+        });
+    } else {
+        for (MKL_INT b = 0; b < blocks; b++) {
+            compute_block(b * kRowBlock);
+        }
+    }
+}
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -27,15 +122,7 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        sgemm_nn_rows(N, K, A, lda, B, ldb, beta, C, ldc, nullptr, M);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +192,7 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        sgemm_nn_rows(N, K, A, lda, B, ldb, beta, C, ldc, OutputList, L);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -30,6 +30,8 @@
 #include "round_float_define.hpp"
 #include "ops/reference/pwl.hpp"
 
+#include <ie_parallel.hpp>
+
 double relu(const double x) { if (x < 0) { return(0.0); } else { return(x); } }
 double leaky_relu(const double x) { if (x < 0.0) { return(LEAKYRELU_SLOPE*x); } else { return(x); } }
 double clipping(const double x, const double lbound, const double ubound) { return((x < lbound)?lbound:((x > ubound)?ubound:x)); }
@@ -353,6 +355,52 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+// the rows are processed in parallel only when there is enough work to amortize the threading overhead
+constexpr size_t kMinParallelWork = 4096;
+
+// The inclusive range of the rows and columns of the component which the activation is applied to
+struct ElementwiseRange {
+    const float *ptr_in;
+    float *ptr_out;
+    uint32_t num_columns;
+    uint32_t num_row_start;
+    uint32_t num_row_end;
+    uint32_t num_col_start;
+    uint32_t num_col_end;
+
+    template <typename F>
+    void ForEachRow(const F& apply_row) const {
+        if (num_row_end < num_row_start || num_col_end < num_col_start) {
+            return;
+        }
+        const uint32_t num_rows = num_row_end - num_row_start + 1;
+        const uint32_t num_cols = num_col_end - num_col_start + 1;
+        if (static_cast<size_t>(num_rows) * num_cols < kMinParallelWork) {
+            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+                apply_row(i);
+            }
+        } else {
+            InferenceEngine::parallel_for(num_rows, [&](uint32_t r) {
+                apply_row(num_row_start + r);
+            });
+        }
+    }
+
+    // The function is applied to the contiguous part of every row, so the inner loop is vectorized for the simple functions
+    template <typename F>
+    void Apply(const F& func) const {
+        ForEachRow([&](uint32_t i) {
+            const float *row_in = ptr_in + i * num_columns;
+            float *row_out = ptr_out + i * num_columns;
+            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+                row_out[j] = func(row_in[j]);
+            }
+        });
+    }
+};
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -362,119 +410,62 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    const ElementwiseRange range{ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end};
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            range.Apply([](float x) -> float { return 0.5 * (1.0 + tanh(0.5 * x)); });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            range.Apply([](float x) -> float { return tanh(x); });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
+            range.Apply([](float x) -> float { return x / (1.0 + fabs(x)); });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+            range.Apply([negative_slope](float x) -> float { return (x < 0.0f) ? x * negative_slope : x; });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            range.Apply([](float x) -> float { return x; });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > upper_limit) {
-                        ptr_out[i * num_columns + j] = upper_limit;
-                    } else if (val < lower_limit) {
-                        ptr_out[i * num_columns + j] = lower_limit;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            range.Apply([upper_limit, lower_limit](float x) -> float {
+                return (x > upper_limit) ? upper_limit : ((x < lower_limit) ? lower_limit : x);
+            });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            range.Apply([](float x) -> float { return exp(x); });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
+            range.Apply([](float x) -> float { return log(x); });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            range.Apply([](float x) -> float { return fabs(x); });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            range.Apply([](float x) -> float { return (x == 0) ? 0.0 : ((x > 0) ? 1.0 : -1.0); });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            range.Apply([](float x) -> float { return -1.0 * log(x); });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            range.Apply([](float x) -> float { return -0.5 * log(x); });
             break;
         case kActPow: {
-                float exponent = transform->func_id.args.pow.exponent;
-                float scale = transform->func_id.args.pow.scale;
-                float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
-                    }
-                }
-            }
+            float exponent = transform->func_id.args.pow.exponent;
+            float scale = transform->func_id.args.pow.scale;
+            float offset = transform->func_id.args.pow.offset;
+            range.Apply([=](float x) -> float { return pow(offset + scale * x, exponent); });
             break;
+        }
         case kActFakeQuantize: {
             double levels  = transform->func_id.fqParams.levels;
 
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            range.ForEachRow([&](uint32_t i) {
                 auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
                 auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
 
@@ -496,7 +487,7 @@ void PwlApply32(intel_dnn_component_t *component,
                             (levels - 1) * (output_high - output_low) + output_low;
                     }
                 }
-            }
+            });
             break;
         }
         case kActCustom:
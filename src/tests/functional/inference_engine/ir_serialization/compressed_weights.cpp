@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common_test_utils/file_utils.hpp>
+#include <common_test_utils/test_common.hpp>
+#include <compress_quantize_weights.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+#include <transformations/disable_decompression_convert_constant_folding.hpp>
+#include <transformations/rt_info/decompression.hpp>
+#include <transformations/serialize.hpp>
+
+// The compressed weights must survive the round trip through IR: the decompression Converts keep their mark,
+// so the constant folding which the plugins run on the read model doesn't unpack the weights back to f32.
+class CompressedWeightsSerializationTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(m_out_xml_path, m_out_bin_path);
+    }
+
+    std::shared_ptr<ov::Model> serializeAndFold(const std::shared_ptr<ov::Model>& model) {
+        ngraph::pass::Manager serialize;
+        serialize.register_pass<ngraph::pass::Serialize>(m_out_xml_path, m_out_bin_path);
+        serialize.run_passes(model);
+
+        ov::Core core;
+        auto readModel = core.read_model(m_out_xml_path, m_out_bin_path);
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ov::pass::DisableDecompressionConvertConstantFolding>();
+        manager.register_pass<ngraph::pass::ConstantFolding>();
+        manager.run_passes(readModel);
+        return readModel;
+    }
+
+    // number of the Constants of the given type which feed the Converts marked as decompression
+    static size_t countCompressedConstants(const std::shared_ptr<ov::Model>& model, const ov::element::Type& type) {
+        size_t count = 0;
+        for (const auto& node : model->get_ops()) {
+            if (!ov::is_type<ov::opset8::Convert>(node) || !ov::is_decompression(node))
+                continue;
+            const auto constant = ov::as_type_ptr<ov::opset8::Constant>(node->get_input_node_shared_ptr(0));
+            if (constant && constant->get_element_type() == type)
+                count++;
+        }
+        return count;
+    }
+};
+
+class CompressedWeightsGroupwiseSerializationTest : public CompressedWeightsSerializationTest,
+                                                    public testing::WithParamInterface<ov::element::Type> {};
+
+TEST_P(CompressedWeightsGroupwiseSerializationTest, WeightsAreNotFoldedAfterReadModel) {
+    const auto weightsType = GetParam();
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 8});
+    std::vector<float> values(4 * 8);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<float>(static_cast<int>(i % 11) - 5) / 4.f;
+    auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{4, 8}, values);
+    auto matmul = std::make_shared<ov::opset8::MatMul>(data, weights, false, true);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{data});
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::CompressWeightsGroupwise>(4, weightsType);
+    manager.run_passes(model);
+    // u4 has the zero point in u4 as well
+    const size_t expected = weightsType == ov::element::u4 ? 2 : 1;
+    ASSERT_EQ(expected, countCompressedConstants(model, weightsType));
+
+    const auto readModel = serializeAndFold(model);
+    ASSERT_EQ(expected, countCompressedConstants(readModel, weightsType));
+    ASSERT_EQ(0, countCompressedConstants(readModel, ov::element::f32));
+}
+
+INSTANTIATE_TEST_SUITE_P(IRSerialization, CompressedWeightsGroupwiseSerializationTest,
+                         ::testing::Values(ov::element::u4, ov::element::i4));
+
+TEST_F(CompressedWeightsSerializationTest, QuantizedWeightsAreNotFoldedAfterReadModel) {
+    auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{2, 4}, {-1.f, -0.5f, 0.f, 0.5f, 1.f, 0.25f, -0.25f, 0.75f});
+    auto inputLow = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {-1.f});
+    auto inputHigh = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {1.f});
+    auto outputLow = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {-1.f});
+    auto outputHigh = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {1.f});
+    auto fq = std::make_shared<ov::opset8::FakeQuantize>(weights, inputLow, inputHigh, outputLow, outputHigh, 256);
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 4});
+    auto matmul = std::make_shared<ov::opset8::MatMul>(data, fq, false, true);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{data});
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::CompressQuantizeWeights>();
+    manager.run_passes(model);
+    ASSERT_EQ(1, countCompressedConstants(model, ov::element::i8));
+
+    const auto readModel = serializeAndFold(model);
+    ASSERT_EQ(1, countCompressedConstants(readModel, ov::element::i8));
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "openvino/frontend/manager.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/core.hpp"
+
+using namespace ov;
+
+class WeightsMmapTest : public ::testing::Test {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+    std::vector<float> m_weights = std::vector<float>(4096);
+
+    void SetUp() override {
+        std::iota(m_weights.begin(), m_weights.end(), 0.f);
+
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, m_weights.size()});
+        auto weights = opset8::Constant::create(element::f32, Shape{1, m_weights.size()}, m_weights);
+        auto add = std::make_shared<opset8::Add>(data, weights);
+        auto model = std::make_shared<Model>(NodeVector{add}, ParameterVector{data});
+
+        pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(model);
+    }
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+
+    std::shared_ptr<Model> read_with_frontend(const ov::AnyVector& params) {
+        frontend::FrontEndManager manager;
+        auto FE = manager.load_by_model(params);
+        EXPECT_NE(nullptr, FE);
+        auto input_model = FE->load(params);
+        EXPECT_NE(nullptr, input_model);
+        return FE->convert(input_model);
+    }
+
+    void check_weights(const std::shared_ptr<Model>& model) {
+        std::shared_ptr<opset8::Constant> constant;
+        for (const auto& op : model->get_ops()) {
+            if (auto c = ov::as_type_ptr<opset8::Constant>(op))
+                constant = c;
+        }
+        ASSERT_NE(nullptr, constant);
+        ASSERT_EQ(m_weights, constant->cast_vector<float>());
+    }
+};
+
+TEST_F(WeightsMmapTest, ReadModelCopiesWeightsByDefault) {
+    Core core;
+    auto model = core.read_model(m_out_xml_path);
+    auto model_with_bin = core.read_model(m_out_xml_path, m_out_bin_path);
+
+    // the weights file may be overwritten while the models are alive
+    {
+        std::ofstream bin(m_out_bin_path, std::ios::binary | std::ios::trunc);
+        bin << "overwritten";
+    }
+    check_weights(model);
+    check_weights(model_with_bin);
+}
+
+TEST_F(WeightsMmapTest, ReadModelMapsWeightsWithProperty) {
+    Core core;
+    ASSERT_FALSE(core.get_property(ov::enable_mmap.name()).as<bool>());
+    core.set_property(ov::enable_mmap(true));
+    ASSERT_TRUE(core.get_property(ov::enable_mmap.name()).as<bool>());
+
+    check_weights(core.read_model(m_out_xml_path));
+    check_weights(core.read_model(m_out_xml_path, m_out_bin_path));
+}
+
+TEST_F(WeightsMmapTest, FrontEndMapsWeightsOnRequest) {
+    check_weights(read_with_frontend({m_out_xml_path}));
+    check_weights(read_with_frontend({m_out_xml_path, m_out_bin_path, ov::AnyMap{ov::enable_mmap(false)}}));
+    check_weights(read_with_frontend({m_out_xml_path, m_out_bin_path, ov::AnyMap{ov::enable_mmap(true)}}));
+}
+
+TEST_F(WeightsMmapTest, FrontEndIgnoresUnrelatedBool) {
+    auto model = read_with_frontend({m_out_xml_path, m_out_bin_path, true});
+    // the weights are copied, so the file may be removed
+    TearDown();
+    check_weights(model);
+}
+
+TEST_F(WeightsMmapTest, MappedWeightsOutliveFrontEnd) {
+    auto model = read_with_frontend({m_out_xml_path, m_out_bin_path, ov::AnyMap{ov::enable_mmap(true)}});
+    TearDown();
+    check_weights(model);
+}
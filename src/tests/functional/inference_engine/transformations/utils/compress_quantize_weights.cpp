@@ -177,3 +177,38 @@ TEST_F(TransformationTestsF, NegativeCompressQuantizeWeightsNonConstantInput) {
     comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
     comparator.enable(FunctionsComparator::CmpValues::ACCURACY);
 }
+
+TEST_F(TransformationTestsF, CompressWeightsGroupwiseU4) {
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset8::Constant::create(element::f32, Shape{2, 4}, {0.f, 1.5f, -1.f, 2.f, 3.f, 3.f, 0.f, 0.f});
+        auto matmul = std::make_shared<opset8::MatMul>(data, weights, false, true);
+        function = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+
+        manager.register_pass<pass::CompressWeightsGroupwise>(2, element::u4);
+    }
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset8::Constant::create(element::u4, Shape{2, 2, 2}, {0, 15, 0, 15, 15, 15, 0, 0});
+        auto convert = std::make_shared<opset8::Convert>(weights, element::f32);
+        auto zero_point = opset8::Constant::create(element::u4, Shape{2, 2, 1}, {0, 5, 0, 0});
+        auto zero_point_convert = std::make_shared<opset8::Convert>(zero_point, element::f32);
+        auto sub = std::make_shared<opset8::Subtract>(convert, zero_point_convert);
+        auto scale = opset8::Constant::create(element::f32, Shape{2, 2, 1}, {1.5f / 15.f, 3.f / 15.f, 3.f / 15.f, 1.f});
+        auto mul = std::make_shared<opset8::Multiply>(sub, scale);
+        auto reshape = std::make_shared<opset8::Reshape>(mul, opset8::Constant::create(element::i64, Shape{2}, {2, 4}), false);
+        auto matmul = std::make_shared<opset8::MatMul>(data, reshape, false, true);
+        function_ref = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    comparator.enable(FunctionsComparator::CmpValues::ACCURACY);
+}
+
+TEST_F(TransformationTestsF, NegativeCompressWeightsGroupwiseIndivisibleGroup) {
+    auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto weights = opset8::Constant::create(element::f32, Shape{3, 2}, {0, 1, 2, 3, 4, 5});
+    auto matmul = std::make_shared<opset8::MatMul>(data, weights);
+    function = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{data});
+
+    manager.register_pass<pass::CompressWeightsGroupwise>(2, element::u4);
+}
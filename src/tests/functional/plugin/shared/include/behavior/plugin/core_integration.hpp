@@ -323,6 +323,13 @@ TEST(IEClassBasicTest, smoke_SetConfigHeteroNoThrow) {
                                  CommonTestUtils::DEVICE_HETERO));
     ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)).as<bool>());
     ASSERT_FALSE(value);
+
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINE)).as<bool>());
+    ASSERT_FALSE(value);
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(PIPELINE), InferenceEngine::PluginConfigParams::YES}},
+                                 CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINE)).as<bool>());
+    ASSERT_TRUE(value);
 }
 
 TEST_P(IEClassSpecificDeviceTestSetConfig, SetConfigSpecificDeviceNoThrow) {
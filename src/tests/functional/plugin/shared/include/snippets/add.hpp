@@ -18,6 +18,15 @@ typedef std::tuple<
         std::string                  // Target Device
 > AddParams;
 
+typedef std::tuple<
+        ov::Shape,                   // Input 0 Shape
+        ov::Shape,                   // Input 1 Shape
+        ov::element::Type,           // Output precision
+        size_t,                      // Expected num nodes
+        size_t,                      // Expected num subgraphs
+        std::string                  // Target Device
+> AddConvertParams;
+
 class Add : public testing::WithParamInterface<ov::test::snippets::AddParams>,
             virtual public ov::test::SnippetsTestsCommon {
 public:
@@ -32,6 +41,22 @@ protected:
     void SetUp() override;
 };
 
+class AddSinhSoftmax : public Add {
+protected:
+    void SetUp() override;
+};
+
+// The inputs are fractional, so the fused and the standalone Convert to integer differ unless both truncate
+class AddSinhConvert : public testing::WithParamInterface<ov::test::snippets::AddConvertParams>,
+                       virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddConvertParams> obj);
+
+protected:
+    void SetUp() override;
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override;
+};
+
 } // namespace snippets
 } // namespace test
 } // namespace ov
\ No newline at end of file
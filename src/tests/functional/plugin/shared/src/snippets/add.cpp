@@ -5,6 +5,7 @@
 #include "common_test_utils/common_utils.hpp"
 #include "snippets/add.hpp"
 #include "subgraph_simple.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 
 namespace ov {
 namespace test {
@@ -43,6 +44,53 @@ namespace snippets {
         function = f.getOriginal();
     }
 
+    void AddSinhSoftmax::SetUp() {
+        ov::Shape inputShape0, inputShape1;
+        std::tie(inputShape0, inputShape1, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+        init_input_shapes({{{}, {inputShape0, }}, {{}, {inputShape1, }}});
+
+        auto f = ov::test::snippets::AddSinhSoftmaxFunction({inputShape0, inputShape1});
+        function = f.getOriginal();
+    }
+
+    std::string AddSinhConvert::getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddConvertParams> obj) {
+        ov::Shape inputShapes0, inputShapes1;
+        ov::element::Type outputType;
+        std::string targetDevice;
+        size_t num_nodes, num_subgraphs;
+        std::tie(inputShapes0, inputShapes1, outputType, num_nodes, num_subgraphs, targetDevice) = obj.param;
+
+        std::ostringstream result;
+        result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes0) << "_";
+        result << "IS[1]=" << CommonTestUtils::vec2str(inputShapes1) << "_";
+        result << "OT=" << outputType << "_";
+        result << "#N=" << num_nodes << "_";
+        result << "#S=" << num_subgraphs << "_";
+        result << "targetDevice=" << targetDevice;
+        return result.str();
+    }
+
+    void AddSinhConvert::SetUp() {
+        ov::Shape inputShape0, inputShape1;
+        ov::element::Type outputType;
+        std::tie(inputShape0, inputShape1, outputType, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+        init_input_shapes({{{}, {inputShape0, }}, {{}, {inputShape1, }}});
+
+        auto f = ov::test::snippets::AddSinhConvertFunction({inputShape0, inputShape1}, outputType);
+        function = f.getOriginal();
+    }
+
+    void AddSinhConvert::generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            // values in [0, 3) with the 0.001 step, so the sum of sinh is fractional and fits both u8 and i8
+            const auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(),
+                                                                        targetInputStaticShapes[i], 3, 0, 1000);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+
 TEST_P(Add, CompareWithRefImpl) {
     run();
     validateNumSubgraphs();
@@ -53,6 +101,16 @@ TEST_P(AddSinh, CompareWithRefImpl) {
     validateNumSubgraphs();
 }
 
+TEST_P(AddSinhSoftmax, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(AddSinhConvert, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
 } // namespace snippets
 } // namespace test
 } // namespace ov
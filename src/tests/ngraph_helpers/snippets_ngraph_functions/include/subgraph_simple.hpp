@@ -45,6 +45,42 @@ protected:
     std::shared_ptr<ov::Model> initOriginal() const override;
     std::shared_ptr<ov::Model> initReference() const override;
 };
+/// AddSinh followed by Softmax over the innermost axis.
+/// Softmax is tokenized together with Add, since reductions over the innermost dimension are supported.
+//   in1       in2
+//   Sinh      Sinh
+//        Add
+//      Softmax
+//      Result
+class AddSinhSoftmaxFunction : public SnippetsFunctionBase {
+public:
+    explicit AddSinhSoftmaxFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        NGRAPH_CHECK(input_shapes.size() == 2, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+};
+/// AddSinh followed by Convert of the result to the output precision.
+/// Only f32 -> bf16 Convert is fused into the subgraph Store, f32 -> integer Convert stays outside of the subgraph,
+/// since the Store rounds to nearest, while Convert truncates.
+//   in1       in2
+//   Sinh      Sinh
+//        Add
+//      Convert
+//      Result
+class AddSinhConvertFunction : public SnippetsFunctionBase {
+public:
+    explicit AddSinhConvertFunction(const std::vector<Shape>& inputShapes, const element::Type& outputType)
+        : SnippetsFunctionBase(inputShapes), output_type(outputType) {
+        NGRAPH_CHECK(input_shapes.size() == 2, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+
+    element::Type output_type;
+};
 /// Simple Eltwise graph fully convertible to Subgraph.
 /// Tokenized simply by attaching eltwises.
 // in1   in2
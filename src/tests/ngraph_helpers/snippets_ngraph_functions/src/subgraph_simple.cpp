@@ -46,6 +46,56 @@ std::shared_ptr<ov::Model> AddSinhFunction::initReference() const {
                                                                       ParameterVector{indata0, indata1}));
     return std::make_shared<ov::Model>(NodeVector{add}, ParameterVector{data0, data1});
 }
+std::shared_ptr<ov::Model> AddSinhSoftmaxFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto sin0 = std::make_shared<ov::op::v0::Sinh>(data0);
+    auto sin1 = std::make_shared<ov::op::v0::Sinh>(data1);
+    auto add = std::make_shared<op::v1::Add>(sin0, sin1);
+    const auto axis = static_cast<int64_t>(add->get_shape().size()) - 1;
+    auto softmax = std::make_shared<op::v8::Softmax>(add, axis);
+    return std::make_shared<ov::Model>(NodeVector{softmax}, ParameterVector{data0, data1});
+}
+std::shared_ptr<ov::Model> AddSinhSoftmaxFunction::initReference() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto sin0 = std::make_shared<ov::op::v0::Sinh>(data0);
+    auto sin1 = std::make_shared<ov::op::v0::Sinh>(data1);
+    auto indata0 = std::make_shared<op::v0::Parameter>(precision, sin0->get_shape());
+    auto indata1 = std::make_shared<op::v0::Parameter>(precision, sin1->get_shape());
+    auto add = std::make_shared<op::v1::Add>(indata0, indata1);
+    const auto axis = static_cast<int64_t>(add->get_shape().size()) - 1;
+    auto softmax = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{sin0, sin1},
+                                          std::make_shared<ov::Model>(NodeVector{std::make_shared<op::v8::Softmax>(add, axis)},
+                                                                      ParameterVector{indata0, indata1}));
+    return std::make_shared<ov::Model>(NodeVector{softmax}, ParameterVector{data0, data1});
+}
+std::shared_ptr<ov::Model> AddSinhConvertFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto sin0 = std::make_shared<ov::op::v0::Sinh>(data0);
+    auto sin1 = std::make_shared<ov::op::v0::Sinh>(data1);
+    auto add = std::make_shared<op::v1::Add>(sin0, sin1);
+    auto convert = std::make_shared<op::v0::Convert>(add, output_type);
+    return std::make_shared<ov::Model>(NodeVector{convert}, ParameterVector{data0, data1});
+}
+std::shared_ptr<ov::Model> AddSinhConvertFunction::initReference() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto sin0 = std::make_shared<ov::op::v0::Sinh>(data0);
+    auto sin1 = std::make_shared<ov::op::v0::Sinh>(data1);
+    auto indata0 = std::make_shared<op::v0::Parameter>(precision, sin0->get_shape());
+    auto indata1 = std::make_shared<op::v0::Parameter>(precision, sin1->get_shape());
+    std::shared_ptr<Node> body_result = std::make_shared<op::v1::Add>(indata0, indata1);
+    if (output_type == element::bf16)
+        body_result = std::make_shared<op::v0::Convert>(body_result, output_type);
+    std::shared_ptr<Node> result = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{sin0, sin1},
+                                          std::make_shared<ov::Model>(NodeVector{body_result},
+                                                                      ParameterVector{indata0, indata1}));
+    if (output_type != element::bf16)
+        result = std::make_shared<op::v0::Convert>(result, output_type);
+    return std::make_shared<ov::Model>(NodeVector{result}, ParameterVector{data0, data1});
+}
 std::shared_ptr<ov::Model> EltwiseFunction::initOriginal() const {
     auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
     auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
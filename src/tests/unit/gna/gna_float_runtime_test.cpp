@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/floatmath.h"
+#include "runtime/pwl.h"
+
+namespace {
+
+std::vector<float> MakeData(size_t size, float scale) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = scale * static_cast<float>(static_cast<int>((i * 7919) % 201) - 100) / 37.0f;
+    }
+    return data;
+}
+
+// the loop which was used for the not transposed matrices before it was optimized
+void NaiveSgemmRows(int N, int K, const float *A, int lda, const float *B, int ldb, float beta, float *C, int ldc,
+                    const std::vector<uint32_t>& rows) {
+    for (size_t l = 0; l < rows.size(); l++) {
+        const int i = static_cast<int>(rows[l]);
+        for (int j = 0; j < N; j++) {
+            float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+            for (int k = 0; k < K; k++) {
+                sum += A[i * lda + k] * B[k * ldb + j];
+            }
+            C[l * ldc + j] = sum;
+        }
+    }
+}
+
+class GNAFloatSgemmTest : public ::testing::TestWithParam<std::tuple<int, int, int, float>> {};
+
+}  // namespace
+
+// The results must be bit exact with the naive loop, since SW_FP32 is used as the accuracy reference
+TEST_P(GNAFloatSgemmTest, Sgemm1MatchesNaiveLoop) {
+    int M, N, K;
+    float beta;
+    std::tie(M, N, K, beta) = GetParam();
+    const auto A = MakeData(M * K, 1.0f);
+    const auto B = MakeData(K * N, 0.5f);
+    auto expected = MakeData(M * N, 2.0f);
+    auto actual = expected;
+
+    std::vector<uint32_t> rows(M);
+    for (int i = 0; i < M; i++) {
+        rows[i] = i;
+    }
+    NaiveSgemmRows(N, K, A.data(), K, B.data(), N, beta, expected.data(), N, rows);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, beta,
+                 actual.data(), N);
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_P(GNAFloatSgemmTest, SubsetMatchesNaiveLoop) {
+    int M, N, K;
+    float beta;
+    std::tie(M, N, K, beta) = GetParam();
+    const auto A = MakeData(M * K, 1.0f);
+    const auto B = MakeData(K * N, 0.5f);
+
+    std::vector<uint32_t> rows;
+    for (int i = M - 1; i >= 0; i -= 3) {
+        rows.push_back(i);
+    }
+    const int L = static_cast<int>(rows.size());
+    auto expected = MakeData(L * N, 2.0f);
+    auto actual = expected;
+
+    NaiveSgemmRows(N, K, A.data(), K, B.data(), N, beta, expected.data(), N, rows);
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, beta,
+                       actual.data(), N, rows.data(), L);
+    ASSERT_EQ(expected, actual);
+}
+
+// the sizes cover both the sequential and the parallel paths
+INSTANTIATE_TEST_SUITE_P(GNAFloatSgemm, GNAFloatSgemmTest,
+                         ::testing::Values(std::make_tuple(1, 1, 1, 1.0f),
+                                           std::make_tuple(37, 3, 29, 1.0f),
+                                           std::make_tuple(37, 3, 29, 0.0f),
+                                           std::make_tuple(512, 8, 67, 1.0f),
+                                           std::make_tuple(512, 1, 130, 0.0f)));
+
+// alpha is not applied for the not transposed matrices, as before the optimization
+TEST(GNAFloatSgemmTest, AlphaIsNotApplied) {
+    const int M = 5, N = 2, K = 3;
+    const auto A = MakeData(M * K, 1.0f);
+    const auto B = MakeData(K * N, 1.0f);
+    std::vector<float> unitAlpha(M * N, 1.0f), otherAlpha(M * N, 1.0f);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0,
+                 unitAlpha.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 2.0, A.data(), K, B.data(), N, 1.0,
+                 otherAlpha.data(), N);
+    ASSERT_EQ(unitAlpha, otherAlpha);
+}
+
+TEST(GNAFloatPwlTest, LeakyReluMatchesNaiveLoop) {
+    // big enough for the rows to be processed in parallel
+    const uint32_t rows = 64, columns = 256;
+    auto input = MakeData(rows * columns, 1.0f);
+    std::vector<float> output(rows * columns, 42.0f);
+
+    intel_dnn_component_t component;
+    component.num_columns_in = columns;
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.op.pwl.func_id = DnnActivation::fromType(kActRelu);
+    component.op.pwl.func_id.args.lrelu.negative_slope = 0.25f;
+
+    const uint32_t row_start = 3, row_end = 60, col_start = 5, col_end = 250;
+    PwlApply32(&component, row_start, row_end, col_start, col_end);
+    for (uint32_t i = 0; i < rows; i++) {
+        for (uint32_t j = 0; j < columns; j++) {
+            const float x = input[i * columns + j];
+            const bool inside = i >= row_start && i <= row_end && j >= col_start && j <= col_end;
+            const float expected = inside ? ((x < 0.0f) ? x * 0.25f : x) : 42.0f;
+            ASSERT_EQ(expected, output[i * columns + j]) << i << " " << j;
+        }
+    }
+}
+
+TEST(GNAFloatPwlTest, EmptyRangeIsNotProcessed) {
+    const uint32_t rows = 4, columns = 8;
+    auto input = MakeData(rows * columns, 1.0f);
+    std::vector<float> output(rows * columns, 42.0f);
+
+    intel_dnn_component_t component;
+    component.num_columns_in = columns;
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.op.pwl.func_id = DnnActivation::fromType(kActIdentity);
+
+    PwlApply32(&component, 3, 1, 0, columns - 1);
+    PwlApply32(&component, 0, rows - 1, 5, 2);
+    ASSERT_EQ(std::vector<float>(rows * columns, 42.0f), output);
+}
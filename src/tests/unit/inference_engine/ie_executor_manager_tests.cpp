@@ -3,8 +3,15 @@
 //
 
 #include <gtest/gtest.h>
+#include <ie_system_conf.h>
 #include <threading/ie_executor_manager.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <numeric>
+#include <vector>
+
 using namespace ::testing;
 using namespace std;
 using namespace InferenceEngine;
@@ -36,3 +43,53 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, executorMgr->getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, budgetedExecutorsShareCores) {
+    auto executorMgr = executorManager();
+    const int cores = getNumberOfCPUCores();
+
+    IStreamsExecutor::Config config1{"Budgeted1", 1, cores};
+    auto executor1 = executorMgr->getBudgetedCPUStreamsExecutor(config1, 1);
+    ASSERT_EQ(cores, config1._streams * config1._threadsPerStream);
+    ASSERT_EQ(0, config1._threadBindingOffset);
+
+    IStreamsExecutor::Config config2{"Budgeted2", cores, 1};
+    auto executor2 = executorMgr->getBudgetedCPUStreamsExecutor(config2, 1);
+    ASSERT_EQ(std::max(1, cores / 2), config2._streams * config2._threadsPerStream);
+    ASSERT_EQ(IStreamsExecutor::ThreadBindingType::CORES, config2._threadBindingType);
+    ASSERT_EQ(2, executorMgr->getBudgetedCPUStreamsExecutorsNumber());
+
+    auto budgeted1 = std::dynamic_pointer_cast<IBudgetedStreamsExecutor>(executor1);
+    auto budgeted2 = std::dynamic_pointer_cast<IBudgetedStreamsExecutor>(executor2);
+    ASSERT_NE(nullptr, budgeted1);
+    ASSERT_NE(nullptr, budgeted2);
+    if (cores >= 2) {
+        // the first executor gives up a part of its cores to the second one
+        auto reserved1 = budgeted1->getReservedCores();
+        auto reserved2 = budgeted2->getReservedCores();
+        ASSERT_EQ(static_cast<size_t>(cores - cores / 2), reserved1.size());
+        ASSERT_EQ(static_cast<size_t>(cores / 2), reserved2.size());
+        for (auto core : reserved1)
+            ASSERT_EQ(reserved2.end(), std::find(reserved2.begin(), reserved2.end(), core));
+    }
+
+    // the tasks run on the rebalanced executor
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    executor1->run([&promise] {
+        promise.set_value();
+    });
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+
+    // the released cores go back to the remaining executor
+    executor2.reset();
+    budgeted2.reset();
+    ASSERT_EQ(1, executorMgr->getBudgetedCPUStreamsExecutorsNumber());
+    std::vector<int> allCores(cores);
+    std::iota(allCores.begin(), allCores.end(), 0);
+    ASSERT_EQ(allCores, budgeted1->getReservedCores());
+
+    executor1.reset();
+    budgeted1.reset();
+    ASSERT_EQ(0, executorMgr->getBudgetedCPUStreamsExecutorsNumber());
+}
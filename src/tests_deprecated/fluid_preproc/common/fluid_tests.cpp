@@ -1224,6 +1224,7 @@ TEST_P(PreprocTest, Performance)
         {
             case Precision::U8:   return CV_8U;
             case Precision::U16:  return CV_16U;
+            case Precision::FP16: return CV_16F;
             case Precision::FP32: return CV_32F;
             default:
                 throw std::logic_error("Unsupported configuration");
@@ -1233,7 +1234,12 @@ TEST_P(PreprocTest, Performance)
 
     const int in_ocv_type  = CV_MAKETYPE(precision_to_depth(in_prec), in_ocv_chan);
     const int out_ocv_type = CV_MAKETYPE(precision_to_depth(out_prec), out_ocv_chan);
-    initMatrixRandU(in_ocv_type, in_size, out_ocv_type, false);
+    // cv::randu() and cv::resize() don't support CV_16F, FP16 input is generated and resized as FP32
+    const bool fp16_input = in_prec == Precision::FP16;
+    initMatrixRandU(fp16_input ? CV_MAKETYPE(CV_32F, in_ocv_chan) : in_ocv_type, in_size, out_ocv_type, false);
+    if (fp16_input) {
+        in_mat1.convertTo(in_mat1, in_ocv_type);
+    }
 
     cv::Mat out_mat(out_size, out_ocv_type);
 
@@ -1271,6 +1277,10 @@ TEST_P(PreprocTest, Performance)
             blob = img2Blob<Precision::FP32>(m1, layout);
             break;
 
+        case Precision::FP16:
+            blob = img2Blob<Precision::FP16>(m1, layout);
+            break;
+
         default:
             throw std::logic_error("Unsupported configuration");
         }
@@ -1299,6 +1309,9 @@ TEST_P(PreprocTest, Performance)
     }
 
     cv::Mat ocv_out_mat(in_mat1);
+    if (fp16_input) {
+        in_mat1.convertTo(ocv_out_mat, CV_MAKETYPE(CV_32F, in_ocv_chan));
+    }
 
     if (in_fmt != ColorFormat::RAW && in_fmt != out_fmt && in_fmt != ColorFormat::NV12) {
         cv::cvtColor(ocv_out_mat, ocv_out_mat, toCvtColorCode(in_fmt, out_fmt));
@@ -1309,7 +1322,7 @@ TEST_P(PreprocTest, Performance)
     auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
     cv::resize(ocv_out_mat, ocv_out_mat, out_size, 0, 0, cv_interp);
 
-    if (in_prec != out_prec) {
+    if (ocv_out_mat.type() != out_ocv_type) {
         cv::Mat ocv_converted;
         ocv_out_mat.convertTo(ocv_converted, out_ocv_type);
         ocv_out_mat = ocv_converted;
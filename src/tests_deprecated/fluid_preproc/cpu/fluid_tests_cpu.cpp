@@ -435,3 +435,12 @@ INSTANTIATE_TEST_SUITE_P(PrecisionConversionsPipelines, PreprocTest,
                                 Values(IE::Layout::NHWC, IE::Layout::NCHW),
                                 Values(std::make_pair(1, 1), std::make_pair(3, 3)),
                                 Values(TEST_SIZES_PREPROC)));
+
+INSTANTIATE_TEST_SUITE_P(FP16Resize, PreprocTest,
+                        Combine(Values(std::make_pair(IE::Precision::FP16, IE::Precision::FP32)),
+                                Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::ColorFormat::RAW),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(IE::Layout::NCHW),
+                                Values(std::make_pair(1, 1), std::make_pair(3, 3), std::make_pair(4, 4)),
+                                Values(TEST_SIZES_PREPROC)));